@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <cstdint>
 #include <coconuts/window_system/Window.h>
 #include <coconuts/EventSystem.h>
 #include <coconuts/Layer.h>
@@ -68,7 +69,7 @@ namespace Coconuts
         
         LayerStack m_LayerStack;
         
-        float m_LastFrameTime = 0.0f;
+        int64_t m_LastFrameTime = 0;    /* ns, monotonic Clock */
     };
     
     
@@ -63,6 +63,13 @@ namespace Coconuts
             uint32_t                    referrerIndex;
         };
         
+        struct Texture2DDedupStats
+        {
+            uint32_t    uniqueTextures  = 0;    // GPU textures held
+            uint32_t    aliasedNames    = 0;    // logical names reusing an already held texture
+            uint64_t    savedBytes      = 0;    // image data not duplicated thanks to aliasing
+        };
+        
         struct HashTableDefs
         {
             struct Textures2DHT
@@ -90,6 +97,10 @@ namespace Coconuts
         static bool StoreTexture2D(const std::string& logicalName, std::shared_ptr<Texture2D> texture2D);
         static bool DeleteTexture2D(const std::string& logicalName);
         
+        /* Imports are deduplicated by canonical path and content hash */
+        static std::vector<std::string> GetTexture2DAliases(const std::string& logicalName);
+        static Texture2DDedupStats GetTexture2DDedupStats();
+        
         static bool CreateSprite(const std::string& logicalName,
                                  const std::string& spriteSheetLogicalName,
                                  const SpriteSelector& selector);
@@ -118,6 +129,10 @@ namespace Coconuts
         /* Keys Lists */
         static std::vector<std::string> m_KeysList_Textures2D;
         static std::vector<std::string> m_KeysList_Sprites;
+        
+        /* Deduplication (canonical path / content hash -> loaded Texture2D) */
+        static std::unordered_map<std::string, std::weak_ptr<Texture2D>>   m_Dedup_Paths;
+        static std::unordered_map<uint64_t, std::weak_ptr<Texture2D>>      m_Dedup_Hashes;
     };
     
 }
@@ -23,12 +23,17 @@
 #include <coconuts/ecs/components/TagComponent.h>
 #include <coconuts/ecs/components/TransformComponent.h>
 #include <coconuts/ecs/components/SpriteComponent.h>
+#include <coconuts/ecs/components/SpriteAnimationComponent.h>
+#include <coconuts/ecs/components/TilemapComponent.h>
+#include <coconuts/ecs/components/ParticleEmitterComponent.h>
 #include <coconuts/ecs/components/OrthoCameraComponent.h>
 #include <coconuts/ecs/components/BehaviorComponent.h>
 #include <coconuts/ecs/components/EventHandlerComponent.h>
 
 // Default Systems
 #include <coconuts/ecs/systems/CameraNavSystem.h>
+#include <coconuts/ecs/systems/SpriteAnimationSystem.h>
+#include <coconuts/ecs/systems/ParticleSystem.h>
 
 // Default Event Handlers
 #include <coconuts/ecs/event_handlers/CameraEventHandler.h>
@@ -18,6 +18,7 @@
 
 #include <coconuts/event_system/EventTypes.h>
 #include <coconuts/event_system/EventDispatcher.h>
+#include <coconuts/event_system/EventQueue.h>
 #include <coconuts/event_system/Event.h>
 #include <coconuts/event_system/WindowEvent.h>
 #include <coconuts/event_system/InputKeyEvent.h>
@@ -16,46 +16,107 @@
 #ifndef POLLING_H
 #define POLLING_H
 
+#include <coconuts/input/InputSnapshot.h>
+
 namespace Coconuts
 {
+    /**
+     * Input state, captured once per frame (Capture()) into an InputSnapshot.
+     * Queries read the snapshot: they answer for the start of the frame
+     * and never call into the window system.
+     */
     class Polling
     {
     public:
+        /**
+         * Devices (or a replayed InputRecorder tape) -> snapshot. Once per frame.
+         * frameSeconds is recorded with the state, or replaced by the tape's.
+         */
+        static void Capture(float& frameSeconds);
+        
+        /**
+         * Fixed step simulation runs 0..N steps per frame. Edges and deltas
+         * are meant to be seen by exactly one step: consumed by the first
+         * step of a frame, held over to the next frame when no step ran.
+         */
+        inline static void ConsumeEdges()
+        {
+            s_Snapshot.Consume();
+        }
+        
+        inline static void HoldEdges()
+        {
+            s_Snapshot.Hold();
+        }
+        
+        inline static const InputSnapshot& GetSnapshot()
+        {
+            return s_Snapshot;
+        }
+        
         /* Key */
         inline static bool IsKeyPressed(int keyCode)
         {
-            return s_Instance->IsKeyPressedImpl(keyCode);
+            return s_Snapshot.IsKeyDown(keyCode);
+        }
+        
+        /* Went down / up since the previous frame */
+        inline static bool WasKeyPressed(int keyCode)
+        {
+            return s_Snapshot.WasKeyPressed(keyCode);
+        }
+        
+        inline static bool WasKeyReleased(int keyCode)
+        {
+            return s_Snapshot.WasKeyReleased(keyCode);
         }
         
         /* Mouse */
         inline static bool IsMouseButtonPressed(int keyCode)
         {
-            return s_Instance->IsMouseButtonPressedImpl(keyCode);
+            return s_Snapshot.IsButtonDown(keyCode);
+        }
+        
+        inline static bool WasMouseButtonPressed(int keyCode)
+        {
+            return s_Snapshot.WasButtonPressed(keyCode);
+        }
+        
+        inline static bool WasMouseButtonReleased(int keyCode)
+        {
+            return s_Snapshot.WasButtonReleased(keyCode);
         }
         
         inline static double GetMouseX()
         {
-            return s_Instance->GetMouseXImpl();
+            return s_Snapshot.state.mouseX;
         }
         
         inline static double GetMouseY()
         {
-            return s_Instance->GetMouseYImpl();
+            return s_Snapshot.state.mouseY;
         }
         
-    protected:
-        /* Platform dependent implementations */
-        virtual bool IsKeyPressedImpl(int keyCode) = 0;
+        /* Cursor movement since the previous frame */
+        inline static double GetMouseDeltaX()
+        {
+            return s_Snapshot.deltaX;
+        }
         
-        virtual bool IsMouseButtonPressedImpl(int keyCode) = 0;
-        virtual double GetMouseXImpl() = 0;
-        virtual double GetMouseYImpl() = 0;
+        inline static double GetMouseDeltaY()
+        {
+            return s_Snapshot.deltaY;
+        }
+        
+    protected:
+        /* Platform dependent implementation: fills state from the devices */
+        virtual void CaptureImpl(InputState& state) = 0;
         
     private:
         static Polling* s_Instance;
+        static InputSnapshot s_Snapshot;
     };
     
 }
 
 #endif /* POLLING_H */
-
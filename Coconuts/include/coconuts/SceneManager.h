@@ -40,6 +40,9 @@ namespace Coconuts
         std::shared_ptr<Scene> NewScene(uint16_t hardcoded_id, const std::string& name, bool hardcoded_activeState);
         bool DeleteScene(uint16_t id);
         
+        /* Puts scene in id's place (keeping id's active state). Returns the one replaced */
+        std::shared_ptr<Scene> ReplaceScene(uint16_t id, const std::shared_ptr<Scene>& scene);
+        
         std::shared_ptr<Scene> GetScene(uint16_t id);
         bool SetActiveScene(uint16_t id);
         std::shared_ptr<Scene> GetActiveScene();
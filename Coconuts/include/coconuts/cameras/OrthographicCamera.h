@@ -34,6 +34,9 @@ namespace Coconuts
         inline void SetPosition(const glm::vec3& position) { m_Position = position; RecalculateViewMatrix(); }
         inline void SetRotation(float rotation) { m_Rotation = rotation; RecalculateViewMatrix(); }
         
+        /* Both at once: the view matrix is rebuilt a single time */
+        inline void SetTransform(const glm::vec3& position, float rotation) { m_Position = position; m_Rotation = rotation; RecalculateViewMatrix(); }
+        
         inline const glm::mat4& GetProjMatrix() const { return m_ProjMatrix; }
         inline const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
         inline const glm::mat4& GetViewProjMatrix() const { return m_ViewProjMatrix; }
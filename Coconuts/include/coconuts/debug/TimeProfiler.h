@@ -39,7 +39,12 @@ namespace Coconuts
             std::string function;
             uint32_t    line;
             uint32_t    deltaTime_us;   // in microseconds
+            uint32_t    threadIndex;    // 0 -> main thread, 1..N -> job workers
         };
+        
+        /* Tags every scope measured on the calling thread */
+        void SetThreadIndex(uint32_t index);
+        uint32_t GetThreadIndex();
     
         
         class TimeProfiler
@@ -57,6 +62,7 @@ namespace Coconuts
         
             static TimeProfiler& GetInstance();
             std::vector<TimeData> Fetch(const std::string& key);
+            std::vector<TimeData> Fetch(const std::string& key, uint32_t threadIndex);
             bool Clear(const std::string& key);
             
         private:
@@ -105,6 +111,7 @@ namespace Coconuts
                 m_Data.function         = m_Function;
                 m_Data.line             = m_Line;
                 m_Data.deltaTime_us     = static_cast<uint32_t> (duration.count());
+                m_Data.threadIndex      = GetThreadIndex();
                 
                 // Publish results
                 TimeProfiler::GetInstance().Push(m_Data);
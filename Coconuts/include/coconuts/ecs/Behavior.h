@@ -17,31 +17,68 @@
 #define BEHAVIORAL_H
 
 #include <coconuts/ecs/Entity.h>
+#include <coconuts/time/Timestep.h>
 
 namespace Coconuts
 {
     
+    /**
+     * Base of all Behaviors (scripts).
+     * Hooks are not virtual: Behaviors of a type are stored together and
+     * called directly (see BehaviorPool). Hide any of the empty defaults
+     * below to use it; an OnUpdate left undeclared is never called.
+     *
+     * A Behavior with nothing to do can Sleep(): its OnUpdate isn't called
+     * until the nap ends, it's woken up or an awaited event arrives.
+     */
     class Behavior
     {
     public:
+        void OnCreate() {}
+        void OnDestroy() {}
+        void OnUpdate(Timestep ts) {}
+        
+        /* Event Handlers: the EventTypes delivered to OnEvent (default: all) */
+        static EventMask GetEventSubscriptions() { return EVENT_MASK_ALL; }
         
         void SetAffectedEntity(Entity& entity)
         {
             m_Entity = entity;
         }
         
+        void BindToRegistry(BehaviorRegistry* registry, const BehaviorHandle& handle)
+        {
+            m_Registry = registry;
+            m_Handle = handle;
+        }
+        
+        const BehaviorHandle& GetHandle() const { return m_Handle; }
+        
+        /* Seconds of simulated time; < 0 -> until Wake() */
+        void Sleep(float seconds) { m_Registry->Sleep(m_Handle, seconds); }
+        void SleepUntil(EventType type) { m_Registry->SleepUntil(m_Handle, type); }
+        void Wake() { m_Registry->Wake(m_Handle); }
+        bool IsSleeping() const { return m_Registry->IsSleeping(m_Handle); }
+        
         template <typename C, typename ... Args>
         C& AddComponent(Args && ... args)
         {
             return m_Entity.AddComponent<C>();
         }
         
+        /* Marks C as changed: prefer ReadComponent() when only reading */
         template <typename C>
         C& GetComponent()
         {
             return m_Entity.GetComponent<C>();
         }
         
+        template <typename C>
+        const C& ReadComponent() const
+        {
+            return m_Entity.ReadComponent<C>();
+        }
+        
         template <typename C>
         bool HasComponent()
         {
@@ -55,6 +92,8 @@ namespace Coconuts
         
     private:
         Entity m_Entity;    // Linked with an Entity / Entities (future)
+        BehaviorRegistry* m_Registry = nullptr;
+        BehaviorHandle m_Handle;
     };
     
 }
@@ -0,0 +1,471 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef BEHAVIORREGISTRY_H
+#define BEHAVIORREGISTRY_H
+
+#include <entityx/entityx.h>
+#include <coconuts/time/Timestep.h>
+#include <coconuts/time/TimerWheel.h>
+#include <coconuts/event_system/EventTypes.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    // forward declared
+    class Behavior;
+    class Entity;
+    class Event;
+    class BehaviorRegistry;
+    struct BehaviorComponent;
+    
+    struct BehaviorHandle
+    {
+        uint32_t type;
+        uint32_t slot;
+        uint32_t generation;
+        
+        BehaviorHandle() : type(UINT32_MAX), slot(0), generation(0) {}
+        BehaviorHandle(uint32_t type, uint32_t slot, uint32_t generation)
+        :   type(type), slot(slot), generation(generation) {}
+        
+        bool IsValid() const { return type != UINT32_MAX; }
+    };
+    
+    class BaseBehaviorPool
+    {
+    public:
+        virtual ~BaseBehaviorPool() = default;
+        
+        virtual void UpdateAll(Timestep ts) = 0;
+        virtual void Remove(uint32_t slot, uint32_t generation) = 0;
+        virtual Behavior* Get(uint32_t slot, uint32_t generation) = 0;
+        
+        /* Sleep returns a token identifying this nap (0 -> not alive); Wake only ends a matching nap (0 -> any) */
+        virtual uint32_t Sleep(uint32_t slot, uint32_t generation) = 0;
+        virtual void Wake(uint32_t slot, uint32_t generation, uint32_t token) = 0;
+        virtual bool IsSleeping(uint32_t slot, uint32_t generation) const = 0;
+        
+        virtual size_t GetSize() const = 0;
+        virtual size_t GetAwakeCount() const = 0;
+        virtual bool HasUpdate() const = 0;
+    };
+    
+    /**
+     * All Behaviors of type C of a Scene, stored contiguously and updated in
+     * one loop with direct calls to C::OnUpdate.
+     * Behaviors that don't declare their own OnUpdate are never iterated.
+     * Awake Behaviors are kept at the front, sleeping ones at the back, so
+     * the loop only costs the awake ones.
+     *
+     * Behaviors move when the pool changes: don't keep pointers to them,
+     * keep their BehaviorHandle (or their Entity) instead.
+     */
+    template <typename C>
+    class BehaviorPool : public BaseBehaviorPool
+    {
+    public:
+        /* C::OnUpdate resolving to Behavior::OnUpdate means C has none */
+        static constexpr bool HAS_UPDATE = !std::is_same<decltype(&C::OnUpdate), void (Behavior::*)(Timestep)>::value;
+        
+        ~BehaviorPool()
+        {
+            for (C& behavior : m_Dense)    behavior.OnDestroy();
+            for (C& behavior : m_Incoming) behavior.OnDestroy();
+        }
+        
+        BehaviorHandle Create(uint32_t type, Entity& affects, BehaviorRegistry* registry)
+        {
+            uint32_t slot;
+            if (!m_FreeSlots.empty())
+            {
+                slot = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+            }
+            else
+            {
+                slot = (uint32_t) m_SlotIndex.size();
+                m_SlotIndex.push_back(0);
+                m_SlotGeneration.push_back(0);
+                m_SlotNap.push_back(0);
+            }
+            
+            BehaviorHandle handle(type, slot, m_SlotGeneration[slot]);
+            C* behavior;
+            
+            if (m_Updating)
+            {
+                /* Created while this pool is being updated: joins it afterwards */
+                m_SlotIndex[slot] = (uint32_t) m_Incoming.size() | INCOMING;
+                m_Incoming.emplace_back();
+                m_IncomingSlots.push_back(slot);
+                behavior = &m_Incoming.back();
+            }
+            else
+            {
+                m_SlotIndex[slot] = (uint32_t) m_Dense.size();
+                m_Dense.emplace_back();
+                m_DenseSlots.push_back(slot);
+                
+                /* New Behaviors are awake */
+                Swap((uint32_t) m_Dense.size() - 1, m_AwakeCount++);
+                behavior = &m_Dense[m_SlotIndex[slot]];
+            }
+            
+            behavior->SetAffectedEntity(affects);
+            behavior->BindToRegistry(registry, handle);
+            behavior->OnCreate();
+            
+            return handle;
+        }
+        
+        void UpdateAll(Timestep ts) override
+        {
+            m_Updating = true;
+            Update(ts, std::integral_constant<bool, HAS_UPDATE>());
+            m_Updating = false;
+            
+            /* Apply what happened during the loop */
+            for (size_t i = 0; i < m_Incoming.size(); i++)
+            {
+                m_SlotIndex[m_IncomingSlots[i]] = (uint32_t) m_Dense.size();
+                m_Dense.emplace_back(std::move(m_Incoming[i]));
+                m_DenseSlots.push_back(m_IncomingSlots[i]);
+                Swap((uint32_t) m_Dense.size() - 1, m_AwakeCount++);
+            }
+            m_Incoming.clear();
+            m_IncomingSlots.clear();
+            
+            std::vector<Deferred> deferred;
+            deferred.swap(m_Deferred);
+            for (const Deferred& op : deferred)
+            {
+                if (!IsAlive(op.slot, op.generation))
+                {
+                    continue;
+                }
+                
+                switch (op.type)
+                {
+                    case Deferred::Remove:  Remove(op.slot, op.generation); break;
+                    case Deferred::Sleep:   SetAwake(op.slot, false); break;
+                    case Deferred::Wake:    if (op.token == 0 || op.token == m_SlotNap[op.slot]) SetAwake(op.slot, true); break;
+                }
+            }
+        }
+        
+        void Remove(uint32_t slot, uint32_t generation) override
+        {
+            if (!IsAlive(slot, generation))
+            {
+                return;
+            }
+            
+            if (m_Updating)
+            {
+                m_Deferred.push_back({ Deferred::Remove, slot, generation, 0 });
+                return;
+            }
+            
+            uint32_t index = m_SlotIndex[slot];
+            if (index & INCOMING)
+            {
+                index &= ~INCOMING;
+                m_Incoming[index].OnDestroy();
+                
+                uint32_t last = (uint32_t) m_Incoming.size() - 1;
+                if (index != last)
+                {
+                    m_Incoming[index] = std::move(m_Incoming[last]);
+                    m_IncomingSlots[index] = m_IncomingSlots[last];
+                    m_SlotIndex[m_IncomingSlots[index]] = index | INCOMING;
+                }
+                m_Incoming.pop_back();
+                m_IncomingSlots.pop_back();
+            }
+            else
+            {
+                m_Dense[index].OnDestroy();
+                
+                /* Leave the awake range first, then the pool */
+                if (index < m_AwakeCount)
+                {
+                    Swap(index, --m_AwakeCount);
+                    index = m_AwakeCount;
+                }
+                
+                uint32_t last = (uint32_t) m_Dense.size() - 1;
+                if (index != last)
+                {
+                    m_Dense[index] = std::move(m_Dense[last]);
+                    m_DenseSlots[index] = m_DenseSlots[last];
+                    m_SlotIndex[m_DenseSlots[index]] = index;
+                }
+                m_Dense.pop_back();
+                m_DenseSlots.pop_back();
+            }
+            
+            m_SlotGeneration[slot]++;
+            m_FreeSlots.push_back(slot);
+        }
+        
+        Behavior* Get(uint32_t slot, uint32_t generation) override
+        {
+            if (!IsAlive(slot, generation))
+            {
+                return nullptr;
+            }
+            
+            uint32_t index = m_SlotIndex[slot];
+            return (index & INCOMING) ? &m_Incoming[index & ~INCOMING] : &m_Dense[index];
+        }
+        
+        uint32_t Sleep(uint32_t slot, uint32_t generation) override
+        {
+            if (!IsAlive(slot, generation))
+            {
+                return 0;
+            }
+            
+            /* A new nap: wake ups meant for an earlier one are ignored */
+            if (++m_SlotNap[slot] == 0)
+            {
+                m_SlotNap[slot] = 1;
+            }
+            
+            if (m_Updating || (m_SlotIndex[slot] & INCOMING))
+            {
+                m_Deferred.push_back({ Deferred::Sleep, slot, generation, 0 });
+            }
+            else
+            {
+                SetAwake(slot, false);
+            }
+            
+            return m_SlotNap[slot];
+        }
+        
+        void Wake(uint32_t slot, uint32_t generation, uint32_t token) override
+        {
+            if (!IsAlive(slot, generation) || (token != 0 && token != m_SlotNap[slot]))
+            {
+                return;
+            }
+            
+            if (m_Updating || (m_SlotIndex[slot] & INCOMING))
+            {
+                m_Deferred.push_back({ Deferred::Wake, slot, generation, token });
+                return;
+            }
+            
+            SetAwake(slot, true);
+        }
+        
+        bool IsSleeping(uint32_t slot, uint32_t generation) const override
+        {
+            if (!IsAlive(slot, generation) || (m_SlotIndex[slot] & INCOMING))
+            {
+                return false;
+            }
+            
+            return m_SlotIndex[slot] >= m_AwakeCount;
+        }
+        
+        size_t GetSize() const override { return m_Dense.size() + m_Incoming.size(); }
+        size_t GetAwakeCount() const override { return m_AwakeCount + m_Incoming.size(); }
+        bool HasUpdate() const override { return HAS_UPDATE; }
+        
+    private:
+        static constexpr uint32_t INCOMING = 0x80000000u;
+        
+        struct Deferred
+        {
+            enum Type : uint8_t { Remove, Sleep, Wake } type;
+            uint32_t slot;
+            uint32_t generation;
+            uint32_t token;
+        };
+        
+        std::vector<C>          m_Dense;            /* [0, m_AwakeCount) awake, then sleeping */
+        std::vector<uint32_t>   m_DenseSlots;       /* dense index -> slot */
+        uint32_t                m_AwakeCount = 0;
+        std::vector<C>          m_Incoming;         /* created during UpdateAll() */
+        std::vector<uint32_t>   m_IncomingSlots;
+        
+        std::vector<uint32_t>   m_SlotIndex;        /* slot -> dense (or incoming) index */
+        std::vector<uint32_t>   m_SlotGeneration;
+        std::vector<uint32_t>   m_SlotNap;          /* current sleep token */
+        std::vector<uint32_t>   m_FreeSlots;
+        
+        bool                    m_Updating = false;
+        std::vector<Deferred>   m_Deferred;
+        
+    private:
+        void Update(Timestep ts, std::true_type)
+        {
+            /* Ranges can't change here: creations, removals and naps are deferred */
+            for (uint32_t i = 0, count = m_AwakeCount; i < count; i++)
+            {
+                m_Dense[i].OnUpdate(ts);
+            }
+        }
+        
+        void Update(Timestep ts, std::false_type) {}
+        
+        bool IsAlive(uint32_t slot, uint32_t generation) const
+        {
+            return slot < m_SlotGeneration.size() && m_SlotGeneration[slot] == generation;
+        }
+        
+        void Swap(uint32_t a, uint32_t b)
+        {
+            if (a == b)
+            {
+                return;
+            }
+            
+            std::swap(m_Dense[a], m_Dense[b]);
+            std::swap(m_DenseSlots[a], m_DenseSlots[b]);
+            m_SlotIndex[m_DenseSlots[a]] = a;
+            m_SlotIndex[m_DenseSlots[b]] = b;
+        }
+        
+        void SetAwake(uint32_t slot, bool awake)
+        {
+            uint32_t index = m_SlotIndex[slot];
+            
+            if (awake && index >= m_AwakeCount)
+            {
+                Swap(index, m_AwakeCount++);
+            }
+            else if (!awake && index < m_AwakeCount)
+            {
+                Swap(index, --m_AwakeCount);
+            }
+        }
+    };
+    
+    /**
+     * Owns a Scene's Behavior pools (one per Behavior type) and drops the
+     * Behaviors of an Entity when its BehaviorComponent is removed.
+     *
+     * Behaviors may sleep for a while (timer wheel) or until an event.
+     * Sleeping ones cost nothing per frame: only awake Behaviors and timers
+     * coming due are touched.
+     */
+    class BehaviorRegistry : public entityx::Receiver<BehaviorRegistry>
+    {
+    public:
+        explicit BehaviorRegistry(entityx::EventManager& events);
+        ~BehaviorRegistry() = default;
+        
+        BehaviorRegistry(const BehaviorRegistry&) = delete;
+        BehaviorRegistry& operator=(const BehaviorRegistry&) = delete;
+        
+        template <typename C>
+        BehaviorHandle Create(Entity& affects)
+        {
+            uint32_t type = TypeId<C>();
+            if (type >= m_Pools.size())
+            {
+                m_Pools.resize(type + 1);
+            }
+            
+            if (m_Pools[type] == nullptr)
+            {
+                m_Pools[type].reset(new BehaviorPool<C>());
+                m_Factories.resize(m_Pools.size(), nullptr);
+                m_Factories[type] = &Make<C>;
+                if (BehaviorPool<C>::HAS_UPDATE)
+                {
+                    m_UpdatedPools.push_back(type);
+                }
+            }
+            
+            return static_cast<BehaviorPool<C>*>(m_Pools[type].get())->Create(type, affects, this);
+        }
+        
+        void Remove(const BehaviorHandle& handle);
+        Behavior* Get(const BehaviorHandle& handle);
+        
+        /**
+         * A new Behavior here, of the type of handle in source (e.g. another
+         * Scene's registry). Not a copy: it's created from scratch (OnCreate).
+         */
+        BehaviorHandle Recreate(const BehaviorRegistry& source, const BehaviorHandle& handle, Entity& affects);
+        
+        /* Wakes due sleepers, then one loop per Behavior type that has an OnUpdate */
+        void UpdateAll(Timestep ts);
+        
+        /* Wakes Behaviors sleeping until an event of this type */
+        void OnEvent(Event& e);
+        
+        /**
+         * Stops calling handle's OnUpdate for seconds of simulated time
+         * (< 0 -> until Wake()). A new nap replaces the previous one.
+         */
+        void Sleep(const BehaviorHandle& handle, float seconds);
+        void SleepUntil(const BehaviorHandle& handle, EventType type);
+        void Wake(const BehaviorHandle& handle);
+        bool IsSleeping(const BehaviorHandle& handle) const;
+        
+        size_t GetBehaviorCount() const;
+        size_t GetAwakeCount() const;
+        size_t GetPoolCount() const;
+        size_t GetUpdatedPoolCount() const { return m_UpdatedPools.size(); }
+        
+        template <typename C>
+        static uint32_t TypeId()
+        {
+            static const uint32_t id = s_NextTypeId++;
+            return id;
+        }
+        
+        void receive(const entityx::ComponentRemovedEvent<BehaviorComponent>& event);
+        
+    private:
+        std::vector<std::unique_ptr<BaseBehaviorPool>>  m_Pools;        /* by TypeId */
+        std::vector<uint32_t>                           m_UpdatedPools;
+        
+        using Factory = BehaviorHandle (*)(BehaviorRegistry& registry, Entity& affects);
+        std::vector<Factory>                            m_Factories;    /* by TypeId */
+        
+        template <typename C>
+        static BehaviorHandle Make(BehaviorRegistry& registry, Entity& affects) { return registry.Create<C>(affects); }
+        
+        struct Sleeper
+        {
+            BehaviorHandle  handle;
+            uint32_t        token;
+        };
+        
+        static constexpr double TICK_SECONDS = 0.001;
+        static constexpr uint32_t EVENT_TYPES = EVENT_TYPE_COUNT;
+        
+        double                  m_Time;         /* simulated seconds */
+        TimerWheel<Sleeper>     m_Timers;       /* in TICK_SECONDS ticks */
+        std::vector<Sleeper>    m_EventSleepers[EVENT_TYPES];
+        
+        static std::atomic<uint32_t> s_NextTypeId;
+    };
+    
+}
+
+#endif /* BEHAVIORREGISTRY_H */
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CACHEDVIEW_H
+#define CACHEDVIEW_H
+
+#include <entityx/entityx.h>
+#include <coconuts/jobs/JobSystem.h>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    class BaseCachedView
+    {
+    public:
+        virtual ~BaseCachedView() = default;
+        virtual size_t GetSize() const = 0;
+    };
+    
+    /**
+     * Persistent list of the entities having all Components, with pointers
+     * to their components.
+     * Kept up to date from entityx's ComponentAdded / ComponentRemoved
+     * events (Entity::AddComponent / RemoveComponent, destroy, ...), so
+     * iterating it neither visits other entities nor tests masks.
+     * Component pointers stay valid: entityx pools never move a live component.
+     */
+    template <typename... Components>
+    class CachedView : public BaseCachedView, public entityx::Receiver<CachedView<Components...>>
+    {
+    public:
+        CachedView(entityx::EntityManager& entities, entityx::EventManager& events)
+        {
+            int expand[] = { 0, (Subscribe<Components>(events), 0)... };
+            (void) expand;
+            
+            for (entityx::Entity entity : entities.entities_with_components<Components...>())
+            {
+                Insert(entity);
+            }
+        }
+        
+        CachedView(const CachedView&) = delete;
+        CachedView& operator=(const CachedView&) = delete;
+        
+        /* fn(entityx::Entity, Components&...). Entities added meanwhile are visited too */
+        template <typename Function>
+        void Each(Function fn)
+        {
+            for (size_t i = 0; i < m_Entries.size(); i++)
+            {
+                Entry entry = m_Entries[i];
+                Invoke(fn, entry, typename MakeIndices<sizeof...(Components)>::Type());
+            }
+        }
+        
+        /* Chunked over the JobSystem: fn must only touch its own entity */
+        template <typename Function>
+        void ParallelEach(Function fn, uint32_t grainSize = 0, const char* name = "CachedView")
+        {
+            JobSystem::ParallelFor((uint32_t) m_Entries.size(), grainSize, [this, &fn](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    Invoke(fn, m_Entries[i], typename MakeIndices<sizeof...(Components)>::Type());
+                }
+            }, name);
+        }
+        
+        size_t GetSize() const override { return m_Entries.size(); }
+        bool IsEmpty() const { return m_Entries.empty(); }
+        
+        /* Room for entries more matches, on entity indices below indices */
+        void Reserve(size_t entries, size_t indices)
+        {
+            m_Entries.reserve(m_Entries.size() + entries);
+            if (indices > m_Position.size())
+            {
+                m_Position.resize(indices, (uint32_t) NONE);
+            }
+        }
+        
+        template <typename C>
+        void receive(const entityx::ComponentAddedEvent<C>& event)
+        {
+            entityx::Entity entity = event.entity;
+            if (!Contains(entity) && HasAll(entity))
+            {
+                Insert(entity);
+            }
+        }
+        
+        template <typename C>
+        void receive(const entityx::ComponentRemovedEvent<C>& event)
+        {
+            Remove(event.entity);
+        }
+        
+    private:
+        struct Entry
+        {
+            entityx::Entity             entity;
+            std::tuple<Components*...>  components;
+        };
+        
+        static constexpr uint32_t NONE = UINT32_MAX;
+        
+        std::vector<Entry>      m_Entries;
+        std::vector<uint32_t>   m_Position;     /* entity index -> entry */
+        
+        template <size_t... I> struct Indices {};
+        template <size_t N, size_t... I> struct MakeIndices : MakeIndices<N - 1, N - 1, I...> {};
+        template <size_t... I> struct MakeIndices<0, I...> { using Type = Indices<I...>; };
+        
+    private:
+        template <typename C>
+        void Subscribe(entityx::EventManager& events)
+        {
+            events.subscribe<entityx::ComponentAddedEvent<C>>(*this);
+            events.subscribe<entityx::ComponentRemovedEvent<C>>(*this);
+        }
+        
+        template <typename Function, size_t... I>
+        static void Invoke(Function& fn, const Entry& entry, Indices<I...>)
+        {
+            fn(entry.entity, *std::get<I>(entry.components)...);
+        }
+        
+        static bool HasAll(entityx::Entity entity)
+        {
+            bool all = true;
+            int expand[] = { 0, (all = all && entity.has_component<Components>(), 0)... };
+            (void) expand;
+            return all;
+        }
+        
+        bool Contains(entityx::Entity entity) const
+        {
+            uint32_t index = entity.id().index();
+            return index < m_Position.size() && m_Position[index] != NONE;
+        }
+        
+        void Insert(entityx::Entity entity)
+        {
+            uint32_t index = entity.id().index();
+            if (index >= m_Position.size())
+            {
+                m_Position.resize(index + 1, (uint32_t) NONE);
+            }
+            
+            m_Position[index] = (uint32_t) m_Entries.size();
+            m_Entries.push_back({ entity, std::make_tuple(entity.component<Components>().get()...) });
+        }
+        
+        void Remove(entityx::Entity entity)
+        {
+            if (!Contains(entity))
+            {
+                return;
+            }
+            
+            uint32_t index = entity.id().index();
+            uint32_t position = m_Position[index];
+            
+            m_Entries[position] = m_Entries.back();
+            m_Position[m_Entries[position].entity.id().index()] = position;
+            m_Entries.pop_back();
+            m_Position[index] = NONE;
+        }
+    };
+    
+}
+
+#endif /* CACHEDVIEW_H */
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CHANGETRACKER_H
+#define CHANGETRACKER_H
+
+#include <entityx/entityx.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Per component type change tracking for a Scene.
+     * Every write access (Entity::GetComponent) stamps the component type
+     * and the entity with a new version; structural changes (entities
+     * created / destroyed, components added / removed) bump the structure
+     * version. Versions come from one process wide clock, so they are
+     * unique across Scenes.
+     *
+     * Consumers (editor panels, caches) register per component type and
+     * collect only the entities changed since their last collection.
+     * Entities are only recorded for types having consumers.
+     * Not thread safe: write through Entity on the main thread only.
+     */
+    class ChangeTracker
+    {
+    public:
+        ChangeTracker();
+        
+        void MarkStructureChanged();
+        uint64_t GetStructureVersion() const { return m_StructureVersion; }
+        
+        /* Latest version stamped by this tracker */
+        uint64_t GetVersion() const { return m_Version; }
+        
+        template <typename C>
+        void MarkChanged(entityx::Entity entity) { MarkChanged(Family<C>(), entity.id()); }
+        
+        template <typename C>
+        uint64_t GetVersion() const { return m_Types[Family<C>()].version; }
+        
+        template <typename C>
+        uint32_t AddConsumer() { return AddConsumer(Family<C>()); }
+        
+        template <typename C>
+        void RemoveConsumer(uint32_t consumer) { RemoveConsumer(Family<C>(), consumer); }
+        
+        /**
+         * Appends to changed the entities whose C changed since this consumer's
+         * last call (destroyed ones included: check validity). Returns true if any.
+         */
+        template <typename C>
+        bool CollectChanges(uint32_t consumer, std::vector<entityx::Entity::Id>& changed)
+        {
+            return CollectChanges(Family<C>(), consumer, changed);
+        }
+        
+    private:
+        static constexpr uint32_t NONE = UINT32_MAX;
+        static constexpr uint64_t FREE_CONSUMER = UINT64_MAX;
+        
+        struct Slot
+        {
+            uint64_t            version     = 0;
+            entityx::Entity::Id id;
+            uint32_t            dirtyPos    = NONE;
+        };
+        
+        struct TypeChanges
+        {
+            uint64_t                version         = 0;
+            uint32_t                consumerCount   = 0;
+            std::vector<uint64_t>   consumers;      /* version seen per consumer */
+            std::vector<Slot>       slots;          /* by entity index */
+            std::vector<uint32_t>   dirty;          /* indices changed since the oldest consumer */
+        };
+        
+        TypeChanges m_Types[entityx::MAX_COMPONENTS];
+        uint64_t    m_Version;
+        uint64_t    m_StructureVersion;
+        
+        static std::atomic<uint64_t> s_Clock;
+        
+    private:
+        template <typename C>
+        static size_t Family() { return entityx::EntityManager::component_family<C>(); }
+        
+        void MarkChanged(size_t family, entityx::Entity::Id id);
+        uint32_t AddConsumer(size_t family);
+        void RemoveConsumer(size_t family, uint32_t consumer);
+        bool CollectChanges(size_t family, uint32_t consumer, std::vector<entityx::Entity::Id>& changed);
+        void Trim(TypeChanges& type);
+    };
+    
+}
+
+#endif /* CHANGETRACKER_H */
@@ -36,6 +36,8 @@ namespace Coconuts
         C& AddComponent(Args && ... args)
         {
             auto& cmp = *(m_EntityxEntity.assign<C>(std::forward<Args>(args) ...).get());
+            m_Scene->GetChangeTracker().MarkStructureChanged();
+            m_Scene->GetChangeTracker().MarkChanged<C>(m_EntityxEntity);
             m_Scene->SetUpdateFlag();
             return cmp;
         }
@@ -44,24 +46,40 @@ namespace Coconuts
         void RemoveComponent()
         {
             m_EntityxEntity.remove<C>();
+            m_Scene->GetChangeTracker().MarkStructureChanged();
             m_Scene->SetUpdateFlag();
         }
         
+        /* Write access: C is marked as changed for this Entity */
         template <typename C>
         C& GetComponent()
         {
             auto& cmp = *(m_EntityxEntity.component<C>().get());
-            m_Scene->SetUpdateFlag();
+            m_Scene->GetChangeTracker().MarkChanged<C>(m_EntityxEntity);
             return cmp;
         }
         
+        /* Read only access: nothing is marked */
+        template <typename C>
+        const C& ReadComponent() const
+        {
+            return *(m_EntityxEntity.component<const C>().get());
+        }
+        
+        template <typename C>
+        const C& GetComponent() const
+        {
+            return ReadComponent<C>();
+        }
+        
         template <typename C>
-        bool HasComponent()
+        bool HasComponent() const
         {
             return m_EntityxEntity.has_component<C>();
         }
         
         uint64_t GetId() const { return m_EntityxEntity.id().id(); }
+        Scene* GetScene() const { return m_Scene; }
         
     private:
         Scene*          m_Scene;            /* The Scene this Entity belongs to */
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ENTITYLIST_H
+#define ENTITYLIST_H
+
+#include <entityx/entityx.h>
+#include <cstdint>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    // forward declared
+    struct TagComponent;
+    
+    /**
+     * A Scene's tagged Entities (the ones created through Entity) in
+     * creation order, maintained from entityx events instead of being
+     * gathered on request.
+     * Destroyed entries are left as holes until the next Compact(), so
+     * destroying many entities at once costs one pass.
+     */
+    class EntityList : public entityx::Receiver<EntityList>
+    {
+    public:
+        explicit EntityList(entityx::EventManager& events);
+        
+        EntityList(const EntityList&) = delete;
+        EntityList& operator=(const EntityList&) = delete;
+        
+        /* Closes the holes left by destroyed entities. Order is kept */
+        void Compact();
+        
+        /* Includes holes until Compact() */
+        size_t GetSize() const { return m_Entries.size(); }
+        size_t GetLiveCount() const { return m_Entries.size() - m_Holes; }
+        
+        /* Room for entries more Entities, on entity indices below indices */
+        void Reserve(size_t entries, size_t indices);
+        
+        /* entityx::Entity::INVALID for a hole */
+        entityx::Entity::Id Get(size_t position) const { return m_Entries[position]; }
+        
+        void receive(const entityx::ComponentAddedEvent<TagComponent>& event);
+        void receive(const entityx::EntityDestroyedEvent& event);
+        
+    private:
+        static constexpr uint32_t NONE = UINT32_MAX;
+        
+        std::vector<entityx::Entity::Id>    m_Entries;
+        std::vector<uint32_t>               m_Position;     /* entity index -> entry */
+        size_t                              m_Holes;
+    };
+    
+}
+
+#endif /* ENTITYLIST_H */
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENTSUBSCRIPTIONINDEX_H
+#define EVENTSUBSCRIPTIONINDEX_H
+
+#include <entityx/entityx.h>
+#include <coconuts/ecs/CachedView.h>
+#include <coconuts/event_system/Event.h>
+#include <cstdint>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    // forward declared
+    struct EventHandlerComponent;
+    
+    /**
+     * A Scene's Event Handlers indexed by the EventTypes they subscribe to,
+     * so an event only reaches the handlers interested in it (a burst of
+     * cursor moves doesn't visit a handler listening to key presses).
+     *
+     * Rebuilt on the next Refresh() after EventHandlerComponents were
+     * added or written (ChangeTracker version) or removed (entityx event).
+     * Handlers added while dispatching get the following events.
+     */
+    class EventSubscriptionIndex : public entityx::Receiver<EventSubscriptionIndex>
+    {
+    public:
+        explicit EventSubscriptionIndex(entityx::EventManager& events);
+        
+        EventSubscriptionIndex(const EventSubscriptionIndex&) = delete;
+        EventSubscriptionIndex& operator=(const EventSubscriptionIndex&) = delete;
+        
+        /* version: EventHandlerComponent's ChangeTracker version */
+        void Refresh(CachedView<EventHandlerComponent>& handlers, uint64_t version);
+        
+        /* Calls OnEvent of the handlers subscribed to e's type */
+        void Dispatch(Event& e);
+        
+        size_t GetSubscriberCount(EventType type) const;
+        
+        void receive(const entityx::ComponentRemovedEvent<EventHandlerComponent>& event);
+        
+    private:
+        struct Subscriber
+        {
+            entityx::Entity         entity;
+            EventHandlerComponent*  component;
+        };
+        
+        std::vector<Subscriber> m_Subscribers[EVENT_TYPE_COUNT];
+        uint64_t                m_Version;
+        bool                    m_Stale;    /* a handler was removed */
+    };
+    
+}
+
+#endif /* EVENTSUBSCRIPTIONINDEX_H */
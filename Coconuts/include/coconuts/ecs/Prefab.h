@@ -0,0 +1,85 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PREFAB_H
+#define PREFAB_H
+
+#include <coconuts/ecs/components/TagComponent.h>
+#include <coconuts/ecs/components/TransformComponent.h>
+#include <coconuts/ecs/components/SpriteComponent.h>
+#include <coconuts/ecs/components/SpriteAnimationComponent.h>
+#include <string>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    // forward declared
+    class Entity;
+    
+    /**
+     * A template Entity: the Components every instance starts with.
+     * Instantiated by Scene::Instantiate(), one or many copies at a time.
+     *
+     * Only plain data Components are kept. Cameras, Behaviors and Event
+     * Handlers are bound to one Entity and are added per instance.
+     */
+    struct Prefab
+    {
+        //data
+        std::string                 name;
+        
+        TagComponent                tag;
+        
+        bool                        hasTransform;
+        TransformComponent          transform;
+        
+        bool                        hasSprite;
+        SpriteComponent             sprite;
+        
+        bool                        hasAnimation;
+        SpriteAnimationComponent    animation;
+        
+        Prefab()
+        : name("Untitled"), tag("Untagged"), hasTransform(false), hasSprite(false), hasAnimation(false) {}
+        
+        Prefab(const std::string& prefabName, const std::string& tagName = "Untagged")
+        : name(prefabName), tag(tagName), hasTransform(false), hasSprite(false), hasAnimation(false) {}
+        
+        /* Snapshot of entity's supported Components */
+        static Prefab FromEntity(const std::string& prefabName, const Entity& entity);
+    };
+    
+    /**
+     * The project's Prefabs, by name.
+     * Saved and loaded with the Scenes by Serializer.
+     */
+    class PrefabLibrary
+    {
+    public:
+        /* Replaces a Prefab with the same name */
+        static void Add(const Prefab& prefab);
+        static bool Remove(const std::string& name);
+        static void Clear();
+        
+        /* nullptr if unknown. Valid until the Prefab is replaced / removed */
+        static const Prefab* Get(const std::string& name);
+        static std::vector<std::string> GetAllNames();
+        static size_t GetSize();
+    };
+    
+}
+
+#endif /* PREFAB_H */
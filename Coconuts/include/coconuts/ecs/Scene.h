@@ -19,6 +19,14 @@
 #include <entityx/entityx.h>
 #include <coconuts/time/Timestep.h>
 #include <coconuts/EventSystem.h>
+#include <coconuts/ecs/SystemScheduler.h>
+#include <coconuts/ecs/BehaviorRegistry.h>
+#include <coconuts/ecs/CachedView.h>
+#include <coconuts/ecs/ChangeTracker.h>
+#include <coconuts/ecs/EntityList.h>
+#include <coconuts/ecs/TransformHierarchy.h>
+#include <coconuts/ecs/EventSubscriptionIndex.h>
+#include <memory>
 #include <vector>
 
 namespace Coconuts
@@ -26,6 +34,13 @@ namespace Coconuts
     
     // forward declared
     class Entity;
+    struct TransformComponent;
+    struct SpriteComponent;
+    struct SpriteAnimationComponent;
+    struct TilemapComponent;
+    struct OrthoCameraComponent;
+    struct EventHandlerComponent;
+    struct Prefab;
     
     class Scene
     {
@@ -33,15 +48,65 @@ namespace Coconuts
         Scene(uint16_t id, const std::string& name, bool isActive = false);
         ~Scene();
         
+        /**
+         * Deep copy, in memory (e.g. the editor's play mode snapshot).
+         * Entities, Components, parent links, settings and systems are copied;
+         * Behaviors and Event Handlers are created anew for the copies.
+         * Entity ids differ from the original's.
+         */
+        std::shared_ptr<Scene> Clone();
+        
         void OnUpdate(Timestep ts);
         void OnEvent(Event& e);
         
+        /**
+         * Simulation (Behaviors and Systems) runs at a fixed rate, independent
+         * of the rendering rate. Transforms are interpolated between the last
+         * two steps when drawing. A rate <= 0 simulates once per frame.
+         */
+        void SetSimulationRate(float hz);
+        float GetFixedTimestep() const { return m_FixedTimestep; }
+        void SetMaxCatchUpSteps(uint32_t steps);
+        uint32_t GetMaxCatchUpSteps() const { return m_MaxCatchUpSteps; }
+        
+        /**
+         * Systems run every simulation step, after the built-in ones
+         * ("Scene:ExecuteBehaviors", "Scene:SpriteAnimations", "Scene:Particles").
+         * Declared component access decides which of them may run concurrently.
+         */
+        void RegisterSystem(const std::string& name, const SystemAccess& access, const SystemFunction& function);
+        bool UnregisterSystem(const std::string& name);
+        SystemScheduler& GetSystemScheduler() { return m_Systems; }
+        BehaviorRegistry& GetBehaviorRegistry() { return m_Behaviors; }
+        ChangeTracker& GetChangeTracker() { return m_Changes; }
+        EntityList& GetEntityList() { return m_EntityList; }
+        TransformHierarchy& GetTransformHierarchy() { return m_Hierarchy; }
+        
+        /* child's Transform becomes relative to parent's. Both need a Transform */
+        bool SetParent(Entity& child, Entity& parent);
+        void ClearParent(Entity& child);
+        
         void OnChangeViewport(float x, float y);
         
         entityx::Entity CreateEntity();
         bool DestroyEntity(uint64_t id);
+        
+        /**
+         * Bulk spawn / destroy. The Scene's lookup tables are grown once for
+         * the whole batch and structural changes are flagged once.
+         * Instantiated Entities are appended to created, if given.
+         * Both return how many Entities were created / destroyed.
+         */
+        uint32_t Instantiate(const Prefab& prefab, uint32_t count = 1, std::vector<Entity>* created = nullptr);
+        uint32_t Instantiate(const std::string& prefabName, uint32_t count = 1, std::vector<Entity>* created = nullptr);
+        uint32_t DestroyEntities(const std::vector<uint64_t>& ids);
+        
+        /* Room for this many more Entities before the next spawn */
+        void Reserve(size_t entities);
+        
         size_t GetNumberOfEntities() const { return m_EntityManager.entities.size(); }
         std::vector<Entity> GetAllEntities();
+        Entity GetEntity(uint64_t id);
         
         bool SetUpdateFlag(bool update = true) { m_IsUpdated = update; return m_IsUpdated;}
         bool SetActiveFlag(bool flag);
@@ -65,15 +130,42 @@ namespace Coconuts
         float m_AspectRatio;
         
         /**
-         * When a new Entity is added or modified m_IsUpdated is set to true.
-         * It's only reset to false when GetAllEntities() is called.
+         * When an Entity is created / destroyed or gets / loses a Component
+         * m_IsUpdated is set to true (component writes are tracked per type
+         * by m_Changes). It's only reset to false when GetAllEntities() is called.
          */
         bool m_IsUpdated;
         
         entityx::EntityX m_EntityManager;   /* Scene's entities */
+        BehaviorRegistry m_Behaviors;       /* Scene's Behaviors, pooled per type */
+        ChangeTracker m_Changes;            /* Per component type versions */
+        EntityList m_EntityList;            /* Tagged entities, creation order */
+        TransformHierarchy m_Hierarchy;     /* Parent links, cached world matrices */
+        
+        /* Hot queries, kept up to date on component add / remove */
+        CachedView<TransformComponent>                              m_Transforms;
+        CachedView<OrthoCameraComponent>                            m_Cameras;
+        CachedView<TransformComponent, TilemapComponent>            m_Tilemaps;
+        CachedView<TransformComponent, SpriteComponent>             m_Sprites;
+        CachedView<TransformComponent, SpriteAnimationComponent>    m_AnimatedSprites;
+        CachedView<EventHandlerComponent>                           m_EventHandlers;
+        
+        EventSubscriptionIndex m_EventSubscriptions;   /* Event Handlers by EventType */
+        
+        /* Fixed step simulation */
+        float m_FixedTimestep;              /* seconds; 0 -> variable step */
+        uint32_t m_MaxCatchUpSteps;         /* per rendered frame */
+        double m_Accumulator;               /* unsimulated time (seconds) */
+        
+        SystemScheduler m_Systems;
         
     private:
+        Scene(uint16_t id, const std::string& name, bool isActive, bool defaultCamera);
+        
         void CreateDefaultSceneCamera();
+        void RegisterDefaultSystems();
+        void Simulate(Timestep ts);
+        void Render(float alpha);
     };
     
 }
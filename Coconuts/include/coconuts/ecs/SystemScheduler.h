@@ -0,0 +1,162 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYSTEMSCHEDULER_H
+#define SYSTEMSCHEDULER_H
+
+#include <entityx/entityx.h>
+#include <coconuts/time/Timestep.h>
+#include <coconuts/jobs/JobSystem.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Components a system touches.
+     * Two systems conflict when one writes a component the other reads or
+     * writes. Exclusive systems (e.g. user scripts, structural changes)
+     * conflict with everything.
+     */
+    struct SystemAccess
+    {
+        entityx::EntityManager::ComponentMask   reads;
+        entityx::EntityManager::ComponentMask   writes;
+        bool                                    exclusive   = false;
+        bool                                    mainThread  = false;    /* never runs on a worker */
+        
+        template <typename... Components>
+        SystemAccess& Read()
+        {
+            int expand[] = { 0, (reads.set(entityx::EntityManager::component_family<Components>()), 0)... };
+            (void) expand;
+            return *this;
+        }
+        
+        template <typename... Components>
+        SystemAccess& Write()
+        {
+            int expand[] = { 0, (writes.set(entityx::EntityManager::component_family<Components>()), 0)... };
+            (void) expand;
+            return *this;
+        }
+        
+        SystemAccess& Exclusive() { exclusive = true; return *this; }
+        SystemAccess& MainThread() { mainThread = true; return *this; }
+        
+        bool ConflictsWith(const SystemAccess& other) const;
+    };
+    
+    using SystemFunction = std::function<void(entityx::EntityManager& entities, Timestep ts)>;
+    
+    /**
+     * Runs a Scene's systems once per simulation step.
+     * Systems are ordered by registration; a system only waits on earlier
+     * systems it conflicts with, so the rest run concurrently on the
+     * JobSystem. The dependency graph is rebuilt when systems change.
+     *
+     * Systems must not create or destroy entities unless Exclusive.
+     */
+    class SystemScheduler
+    {
+    public:
+        SystemScheduler();
+        ~SystemScheduler() = default;
+        
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+        
+        /* Same name replaces the existing system (keeps its order) */
+        void Register(const std::string& name, const SystemAccess& access, const SystemFunction& function);
+        bool Unregister(const std::string& name);
+        
+        /* Appends source's systems not registered here (by name), in source's order */
+        void Merge(const SystemScheduler& source);
+        
+        void Run(entityx::EntityManager& entities, Timestep ts);
+        
+        /* false -> run every system in registration order on the calling thread */
+        void SetParallel(bool parallel) { m_Parallel = parallel; }
+        bool IsParallel() const { return m_Parallel; }
+        
+        size_t GetSystemCount() const { return m_Systems.size(); }
+        const std::string& GetSystemName(size_t index) const { return m_Systems[index].name; }
+        
+        /* Longest chain of dependent systems (1 -> everything may run at once) */
+        uint32_t GetCriticalPathLength();
+        
+        /**
+         * Chunked parallel iteration for use inside a system.
+         * Entities with all Components are gathered first, then split in
+         * ranges of grainSize (0 -> automatic) over the JobSystem.
+         * fn(entityx::Entity, Components&...) must only touch its own entity.
+         */
+        template <typename... Components, typename Function>
+        static void ForEachParallel(entityx::EntityManager& entities, Function fn,
+                                    uint32_t grainSize = 0, const char* name = "ForEachParallel")
+        {
+            std::vector<entityx::Entity> matching;
+            for (entityx::Entity entity : entities.entities_with_components<Components...>())
+            {
+                matching.push_back(entity);
+            }
+            
+            JobSystem::ParallelFor((uint32_t) matching.size(), grainSize, [&matching, &fn]
+            (uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    entityx::Entity entity = matching[i];
+                    fn(entity, *entity.component<Components>()...);
+                }
+            }, name);
+        }
+        
+    private:
+        struct System
+        {
+            std::string             name;
+            SystemAccess            access;
+            SystemFunction          function;
+            std::vector<uint32_t>   successors;
+            uint32_t                predecessorCount;
+        };
+        
+        std::vector<System> m_Systems;
+        bool m_Parallel;
+        bool m_Dirty;
+        
+        /* Per Run() */
+        entityx::EntityManager* m_Entities;
+        Timestep m_Timestep;
+        std::unique_ptr<std::atomic<uint32_t>[]> m_Waiting;    /* unfinished predecessors */
+        std::atomic<uint32_t> m_Remaining;                      /* unfinished systems */
+        std::mutex m_MainThreadGuard;
+        std::vector<uint32_t> m_MainThreadReady;
+        
+    private:
+        void Rebuild();
+        void Dispatch(uint32_t index);
+        void Execute(uint32_t index);
+    };
+    
+}
+
+#endif /* SYSTEMSCHEDULER_H */
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TRANSFORMHIERARCHY_H
+#define TRANSFORMHIERARCHY_H
+
+#include <entityx/entityx.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    // forward declared
+    struct TransformComponent;
+    
+    /**
+     * Parent / child links between the Scene's Transforms and a cache of
+     * their world matrices (world = parent world * local).
+     * A child's position, size and rotation are relative to its parent,
+     * and the parent's size scales its children like the rest of its transform.
+     *
+     * Nodes live in one array in breadth first order: parents always come
+     * before their children. Update() walks it once, comparing each local
+     * Transform with the one its matrix was built from, and recomputes only
+     * the changed nodes and everything below them.
+     * Both the current and the previous (fixed step) states are cached, so
+     * rendering can still interpolate between simulation steps.
+     */
+    class TransformHierarchy : public entityx::Receiver<TransformHierarchy>
+    {
+    public:
+        explicit TransformHierarchy(entityx::EventManager& events);
+        
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+        
+        /* Both need a TransformComponent. Fails if parent is below child */
+        bool SetParent(entityx::Entity child, entityx::Entity parent);
+        void ClearParent(entityx::Entity child);
+        
+        /* entityx::Entity::INVALID for roots */
+        entityx::Entity::Id GetParent(entityx::Entity child) const;
+        
+        void Update();
+        
+        /* As of the last Update(). Identity for entities without a Transform */
+        const glm::mat4& GetWorldMatrix(entityx::Entity entity) const;
+        
+        /* alpha in [0, 1]: 0 -> previous step, 1 -> current */
+        glm::mat4 GetInterpolatedWorldMatrix(entityx::Entity entity, float alpha) const;
+        
+        size_t GetSize() const { return m_Nodes.size(); }
+        
+        /* Room for nodes more Transforms, on entity indices below indices */
+        void Reserve(size_t nodes, size_t indices);
+        uint32_t GetLastUpdateCount() const { return m_LastUpdateCount; }
+        
+        /* Same convention as Renderer2D's rotated quads */
+        static glm::mat4 ComposeLocal(const glm::vec2& position, const glm::vec2& size, float rotationRadians);
+        
+        void receive(const entityx::ComponentAddedEvent<TransformComponent>& event);
+        void receive(const entityx::ComponentRemovedEvent<TransformComponent>& event);
+        
+    private:
+        static constexpr uint32_t NONE = UINT32_MAX;
+        
+        struct Node
+        {
+            entityx::Entity::Id         id;
+            const TransformComponent*   local;
+            uint32_t                    parent;         /* entity index */
+            uint32_t                    parentPos;      /* position in m_Nodes, valid once sorted */
+            uint32_t                    childCount;
+            bool                        dirty;          /* forced recompute (new / reparented) */
+            bool                        changed;        /* recomputed by this Update() */
+            
+            /* Local state the matrices were built from */
+            glm::vec2   position,           size;
+            float       rotation;
+            glm::vec2   previousPosition,   previousSize;
+            float       previousRotation;
+            
+            glm::mat4   world;
+            glm::mat4   previousWorld;
+            
+            Node(entityx::Entity::Id entityId, const TransformComponent* component);
+        };
+        
+        std::vector<Node>       m_Nodes;            /* breadth first */
+        std::vector<uint32_t>   m_Position;         /* entity index -> node */
+        bool                    m_OrderDirty;
+        uint32_t                m_LastUpdateCount;
+        
+        /* Sort scratch, kept to avoid reallocating */
+        std::vector<uint32_t>   m_FirstChild;
+        std::vector<uint32_t>   m_NextSibling;
+        std::vector<uint32_t>   m_Order;
+        std::vector<Node>       m_Sorted;
+        
+    private:
+        void Sort();
+        uint32_t Find(entityx::Entity::Id id) const;
+        void Detach(uint32_t position);
+    };
+    
+}
+
+#endif /* TRANSFORMHIERARCHY_H */
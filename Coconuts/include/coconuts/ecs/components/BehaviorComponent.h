@@ -17,44 +17,114 @@
 #define BEHAVIORCOMPONENT_H
 
 #include <coconuts/ecs/Behavior.h>
+#include <coconuts/ecs/BehaviorRegistry.h>
 #include <coconuts/time/Timestep.h>
 #include <coconuts/Logger.h>
-#include <functional>
 
 
 namespace Coconuts
 {
     
+    /**
+     * Handles to the Behaviors of an Entity.
+     * The Behaviors themselves live in their Scene's BehaviorRegistry and
+     * are destroyed with this component.
+     */
     struct BehaviorComponent
     {
-        //TODO make an array of instance pointers so an Entity can have multiple Behaviors
-        Behavior* instance = nullptr;
-        std::function<void()> Instantiate;
-        std::function<void()> Destroy;
+        static constexpr uint32_t MAX_BEHAVIORS = 8;
         
-        std::function<void(Behavior*)> OnCreateFunc;
-        std::function<void(Behavior*)> OnDestroyFunc;
-        std::function<void(Behavior*, Timestep)> OnUpdateFunc;
+        BehaviorHandle behaviors[MAX_BEHAVIORS];
+        uint32_t count = 0;
+        BehaviorRegistry* registry = nullptr;
         
         template <typename C>
-        void AddBehavior(Entity& affects)
-        {   
-            Instantiate = [&]() { instance = new C(); };
-            Destroy = [&]() { delete (C*)instance; instance = nullptr; };
+        C* AddBehavior(Entity& affects)
+        {
+            if (count == MAX_BEHAVIORS)
+            {
+                LOG_ERROR("BehaviorComponent - Entity {} already has {} Behaviors", affects.GetId(), MAX_BEHAVIORS);
+                return nullptr;
+            }
             
-            OnCreateFunc = [](Behavior* inst) { ((C*) inst)->OnCreate(); };
-            OnDestroyFunc = [](Behavior* inst) { ((C*) inst)->OnDestroy(); };
-            OnUpdateFunc = [](Behavior* inst, Timestep ts) { ((C*) inst)->OnUpdate(ts); };
+            /* Instantiate object of Behavior class, linked to the entity affected by it */
+            registry = &affects.GetScene()->GetBehaviorRegistry();
+            behaviors[count] = registry->Create<C>(affects);
             
-            /* Instantiate object of Behavior class */
-            Instantiate();
+            return static_cast<C*>(registry->Get(behaviors[count++]));
+        }
+        
+        /* First Behavior of type C (moves as the pool changes: don't keep it) */
+        template <typename C>
+        C* GetBehavior()
+        {
+            int32_t index = Find(BehaviorRegistry::TypeId<C>());
+            return (index < 0) ? nullptr : static_cast<C*>(registry->Get(behaviors[index]));
+        }
+        
+        template <typename C>
+        bool HasBehavior() const
+        {
+            return Find(BehaviorRegistry::TypeId<C>()) >= 0;
+        }
+        
+        template <typename C>
+        bool RemoveBehavior()
+        {
+            int32_t index = Find(BehaviorRegistry::TypeId<C>());
+            if (index < 0)
+            {
+                return false;
+            }
+            
+            registry->Remove(behaviors[index]);
             
-            /* Link it to an entity affected by this behavior */
-            instance->SetAffectedEntity(affects);
+            /* Keep handles packed, in order */
+            for (uint32_t i = (uint32_t) index + 1; i < count; i++)
+            {
+                behaviors[i - 1] = behaviors[i];
+            }
+            behaviors[--count] = BehaviorHandle();
+            
+            return true;
+        }
+        
+        /* Fresh Behaviors of the same types as source's (e.g. on a cloned Entity) */
+        void RecreateBehaviors(const BehaviorComponent& source, Entity& affects)
+        {
+            if (source.registry == nullptr)
+            {
+                return;
+            }
+            
+            registry = &affects.GetScene()->GetBehaviorRegistry();
+            for (uint32_t i = 0; i < source.count && count < MAX_BEHAVIORS; i++)
+            {
+                BehaviorHandle handle = registry->Recreate(*source.registry, source.behaviors[i], affects);
+                if (handle.IsValid())
+                {
+                    behaviors[count++] = handle;
+                }
+            }
+        }
+        
+        uint32_t GetBehaviorCount() const { return count; }
+        
+    private:
+        int32_t Find(uint32_t type) const
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                if (behaviors[i].type == type)
+                {
+                    return (int32_t) i;
+                }
+            }
+            
+            return -1;
         }
     };
     
 }
 
 #endif /* BEHAVIORCOMPONENT_H */
-
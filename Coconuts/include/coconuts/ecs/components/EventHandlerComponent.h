@@ -28,6 +28,13 @@ namespace Coconuts
     {
         //TODO make an array of instance pointers so an Entity can have multiple Event Handlers
         EventHandler* instance = nullptr;
+        
+        /**
+         * EventTypes dispatched to this handler, from C::GetEventSubscriptions().
+         * The Scene indexes handlers by it: change it through Entity::GetComponent.
+         */
+        EventMask subscriptions = EVENT_MASK_ALL;
+        
         std::function<void()> Instantiate;
         std::function<void()> Destroy;
         
@@ -35,6 +42,9 @@ namespace Coconuts
         std::function<void(EventHandler*)> OnDestroyFunc;
         std::function<void(EventHandler*, Event&)> OnEventFunc;
         
+        /* Adds a new handler of this one's type to another component (e.g. a cloned Entity's) */
+        std::function<void(EventHandlerComponent&, Entity&)> AddHandlerTo;
+        
         template <typename C>
         void AddHandler(Entity& affects)
         {   
@@ -44,6 +54,9 @@ namespace Coconuts
             OnCreateFunc = [](EventHandler* inst) { ((C*) inst)->OnCreate(); };
             OnDestroyFunc = [](EventHandler* inst) { ((C*) inst)->OnDestroy(); };
             OnEventFunc = [](EventHandler* inst, Event& e) { ((C*) inst)->OnEvent(e); };
+            AddHandlerTo = [](EventHandlerComponent& other, Entity& entity) { other.AddHandler<C>(entity); };
+            
+            subscriptions = C::GetEventSubscriptions();
             
             /* Instantiate object of EventHandler class */
             Instantiate();
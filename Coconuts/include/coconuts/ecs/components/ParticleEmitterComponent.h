@@ -0,0 +1,70 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PARTICLEEMITTERCOMPONENT_H
+#define PARTICLEEMITTERCOMPONENT_H
+
+#include <coconuts/graphics/ParticlePool.h>
+#include <coconuts/graphics/Sampler.h>
+#include <memory>
+
+namespace Coconuts
+{
+    
+    /**
+     * Emits particles at the Entity's TransformComponent position.
+     * Particles live in world space (moving the Entity does not drag them).
+     */
+    struct ParticleEmitterComponent
+    {
+        //data
+        std::shared_ptr<ParticlePool>   pool;
+        ParticleProps                   props;
+        float                           emissionRate;   // particles per second
+        bool                            emitting;
+        float                           emissionDebt;   // fractional particles carried between frames
+        
+        /* Optional texture (nullptr -> flat colored quads) */
+        std::shared_ptr<Texture2D>      texture;
+        std::shared_ptr<Sampler>        sampler;
+        
+        ParticleEmitterComponent()
+        : emissionRate(0.0f), emitting(false), emissionDebt(0.0f)
+        {
+            // do nothing
+        }
+        
+        ParticleEmitterComponent(uint32_t maxParticles,
+                                 float rate,
+                                 const ParticleProps& particleProps = ParticleProps())
+        : pool(std::make_shared<ParticlePool>(maxParticles)),
+          props(particleProps), emissionRate(rate), emitting(true), emissionDebt(0.0f)
+        {
+            // do nothing
+        }
+        
+        /* One-shot burst */
+        void Burst(uint32_t amount, const glm::vec2& position)
+        {
+            if (pool != nullptr)
+            {
+                pool->Emit(amount, position, props);
+            }
+        }
+    };
+    
+}
+
+#endif /* PARTICLEEMITTERCOMPONENT_H */
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SPRITEANIMATIONCOMPONENT_H
+#define SPRITEANIMATIONCOMPONENT_H
+
+#include <coconuts/graphics/SpriteAnimationClip.h>
+#include <coconuts/graphics/Sampler.h>
+#include <glm/glm.hpp>
+#include <memory>
+
+namespace Coconuts
+{
+    
+    /**
+     * Animated alternative to SpriteComponent.
+     * Frames are advanced by SpriteAnimationSystem and drawn straight from
+     * the clip's texture coordinates table. An Entity holding both components
+     * is drawn as an animation only.
+     */
+    struct SpriteAnimationComponent
+    {
+        //data
+        std::shared_ptr<SpriteAnimationClip>    clip;
+        glm::vec4                               tintColor;
+        float                                   tilingFactor;
+        float                                   speed;      // playback rate multiplier
+        
+        /* Playback state */
+        uint32_t                                frame;
+        float                                   elapsed;    // seconds into current frame
+        bool                                    playing;
+        
+        /* Optional sampling override (nullptr -> sprite sheet's own sampling) */
+        std::shared_ptr<Sampler>                sampler;
+        
+        SpriteAnimationComponent()
+        : tintColor(glm::vec4(1.0f)), tilingFactor(1.0f), speed(1.0f),
+          frame(0), elapsed(0.0f), playing(false)
+        {
+            // do nothing
+        }
+        
+        SpriteAnimationComponent(const std::shared_ptr<SpriteAnimationClip>& animationClip,
+                                 const glm::vec4& color = glm::vec4(1.0f),
+                                 float playbackSpeed = 1.0f)
+        : clip(animationClip), tintColor(color), tilingFactor(1.0f), speed(playbackSpeed),
+          frame(0), elapsed(0.0f), playing(true)
+        {
+            // do nothing
+        }
+        
+        void Play(const std::shared_ptr<SpriteAnimationClip>& animationClip)
+        {
+            clip = animationClip;
+            frame = 0;
+            elapsed = 0.0f;
+            playing = true;
+        }
+        
+        void Stop() { playing = false; }
+    };
+    
+}
+
+#endif /* SPRITEANIMATIONCOMPONENT_H */
@@ -17,6 +17,7 @@
 #define SPRITECOMPONENT_H
 
 #include <coconuts/graphics/Sprite.h>
+#include <coconuts/graphics/Sampler.h>
 #include <glm/glm.hpp>
 #include <memory>
 #include <string>
@@ -33,6 +34,9 @@ namespace Coconuts
         float                   tilingFactor;
         std::weak_ptr<Sprite>   sprite;
         
+        /* Optional sampling override (nullptr -> sprite sheet's own sampling) */
+        std::shared_ptr<Sampler> sampler;
+        
         SpriteComponent()
         : spriteLogicalName("###unknown"), tintColor(glm::vec4(1.0f)), tilingFactor(1.0f)
         {
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TILEMAPCOMPONENT_H
+#define TILEMAPCOMPONENT_H
+
+#include <coconuts/graphics/Tilemap.h>
+#include <coconuts/graphics/Sampler.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <coconuts/AssetManager.h>
+
+namespace Coconuts
+{
+    
+    /**
+     * A whole grid of tiles in a single Entity.
+     * TransformComponent position is the bottom-left corner of tile (0, 0);
+     * size and rotation are ignored (see Tilemap::GetTileSize()).
+     */
+    struct TilemapComponent
+    {
+        //data
+        std::string                 tilesetLogicalName;     // Texture2D asset
+        std::shared_ptr<Tilemap>    tilemap;
+        
+        /* Optional sampling override (nullptr -> tileset's own sampling) */
+        std::shared_ptr<Sampler>    sampler;
+        
+        TilemapComponent()
+        : tilesetLogicalName("###unknown")
+        {
+            // do nothing
+        }
+        
+        TilemapComponent(const std::string& tilesetName,
+                         const glm::vec2& cellSize,
+                         uint32_t width,
+                         uint32_t height,
+                         const glm::vec2& tileSize = glm::vec2(1.0f))
+        : tilesetLogicalName(tilesetName)
+        {
+            tilemap = std::make_shared<Tilemap>(width, height, tileSize);
+            tilemap->SetTileset(AssetManager::GetTexture2D(tilesetLogicalName), cellSize);
+        }
+    };
+    
+}
+
+#endif /* TILEMAPCOMPONENT_H */
@@ -28,11 +28,42 @@ namespace Coconuts
         glm::vec2   size;
         float       rotationRadians;
         
+        /**
+         * State at the start of the last fixed simulation step.
+         * Rendering blends between this and the current state, so motion
+         * stays smooth when the display refreshes faster than the simulation.
+         */
+        glm::vec2   previousPosition;
+        glm::vec2   previousSize;
+        float       previousRotationRadians;
+        
         TransformComponent()
-        : position(glm::vec2(0.0f)), size(glm::vec2(1.0f)), rotationRadians(0.0f) {}
+        : position(glm::vec2(0.0f)), size(glm::vec2(1.0f)), rotationRadians(0.0f),
+          previousPosition(position), previousSize(size), previousRotationRadians(rotationRadians) {}
         
         TransformComponent(const glm::vec2& pos, const glm::vec2& sz = glm::vec2(1.0f), float rotationInRadians = 0.0f)
-        : position(pos), size(sz), rotationRadians(rotationInRadians) {}
+        : position(pos), size(sz), rotationRadians(rotationInRadians),
+          previousPosition(pos), previousSize(sz), previousRotationRadians(rotationInRadians) {}
+        
+        /* Called before each fixed step */
+        void StorePrevious()
+        {
+            previousPosition = position;
+            previousSize = size;
+            previousRotationRadians = rotationRadians;
+        }
+        
+        /* Skip interpolation after a teleport (no blending from the old place) */
+        void Teleport(const glm::vec2& pos)
+        {
+            position = pos;
+            StorePrevious();
+        }
+        
+        /* alpha in [0, 1]: 0 -> previous step, 1 -> current */
+        glm::vec2 GetInterpolatedPosition(float alpha) const { return glm::mix(previousPosition, position, alpha); }
+        glm::vec2 GetInterpolatedSize(float alpha) const { return glm::mix(previousSize, size, alpha); }
+        float GetInterpolatedRotation(float alpha) const { return glm::mix(previousRotationRadians, rotationRadians, alpha); }
     };
     
 }
@@ -29,6 +29,11 @@ namespace Coconuts
         void OnDestroy();
         void OnEvent(Event& e);
         
+        static EventMask GetEventSubscriptions()
+        {
+            return EventMaskOf(EventType::WindowResize) | EventMaskOf(EventType::MouseScroll);
+        }
+        
     private:
         bool OnWindowResizeEvent(WindowEvent::WindowResize& e);
         bool OnScrollEvent(InputMouseEvent::MouseScroll& e);
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PARTICLESYSTEM_H
+#define PARTICLESYSTEM_H
+
+#include <entityx/entityx.h>
+#include <coconuts/time/Timestep.h>
+
+namespace Coconuts
+{
+    
+    /**
+     * Engine system (not a Behavior): emits and simulates every
+     * ParticleEmitterComponent of a Scene once per frame.
+     */
+    class ParticleSystem
+    {
+    public:
+        static void OnUpdate(entityx::EntityManager& entities, Timestep ts);
+        
+        /* Between Renderer2D::BeginScene / EndScene */
+        static void OnRender(entityx::EntityManager& entities);
+    };
+    
+}
+
+#endif /* PARTICLESYSTEM_H */
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SPRITEANIMATIONSYSTEM_H
+#define SPRITEANIMATIONSYSTEM_H
+
+#include <entityx/entityx.h>
+#include <coconuts/time/Timestep.h>
+
+namespace Coconuts
+{
+    
+    /**
+     * Engine system (not a Behavior): advances every SpriteAnimationComponent
+     * of a Scene in one pass, once per frame.
+     */
+    class SpriteAnimationSystem
+    {
+    public:
+        static void OnUpdate(entityx::EntityManager& entities, Timestep ts);
+    };
+    
+}
+
+#endif /* SPRITEANIMATIONSYSTEM_H */
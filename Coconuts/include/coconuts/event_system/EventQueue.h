@@ -0,0 +1,113 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <coconuts/event_system/Event.h>
+#include <coconuts/event_system/EventTypes.h>
+#include <cstdint>
+#include <functional>
+
+namespace Coconuts
+{
+    
+    struct EventQueueStatistics
+    {
+        /* Last batch */
+        uint32_t queued         = 0;    /* pushed, coalesced ones included */
+        uint32_t coalesced      = 0;    /* merged into a pending event */
+        uint32_t dispatched     = 0;
+        
+        /* Since start */
+        uint64_t totalQueued        = 0;
+        uint64_t totalCoalesced     = 0;
+        uint64_t totalDispatched    = 0;
+        uint32_t overflows          = 0;    /* batches dispatched early (queue full) */
+    };
+    
+    /**
+     * A Window's events for one frame.
+     * Window manager callbacks Push() their events while polling; Dispatch()
+     * delivers them in one batch, in order, at a defined point of the frame.
+     *
+     * Back to back redundant events are coalesced while pending (any other
+     * event in between ends the run, so the order is never changed):
+     *   - cursor moves:    the latest position;
+     *   - window resizes:  the latest size;
+     *   - key repeats:     one KeyPress per key with the repeats summed.
+     *
+     * Events are stored as plain records in a fixed array and re-created on
+     * the stack to be dispatched: no heap allocation per event.
+     * Main thread only.
+     */
+    class EventQueue
+    {
+    public:
+        using EventCallback = std::function<void(Event& event)>;
+        
+        static constexpr uint32_t CAPACITY = 256;
+        
+        EventQueue();
+        
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+        
+        void SetCallback(const EventCallback& callback) { m_Callback = callback; }
+        
+        /* False for an EventType it can't record (not queued) */
+        bool Push(const Event& event);
+        
+        /* Delivers the pending events to the callback */
+        void Dispatch();
+        
+        uint32_t GetSize() const { return m_Count; }
+        const EventQueueStatistics& GetStatistics() const { return m_Stats; }
+        
+    private:
+        struct Record
+        {
+            EventType   type;
+            int32_t     code;       /* key / button; WindowMinimize: minimized */
+            uint32_t    repeats;
+            double      x, y;       /* cursor / scroll / size */
+        };
+        
+        static constexpr uint32_t NONE = UINT32_MAX;
+        
+        Record          m_Events[CAPACITY];
+        uint32_t        m_Count;
+        
+        /* Pending events later ones of the same kind are merged into */
+        uint32_t        m_LastMove;
+        uint32_t        m_LastResize;
+        uint32_t        m_LastRepeat;
+        
+        bool            m_Dispatching;
+        EventCallback   m_Callback;
+        
+        EventQueueStatistics m_Stats;
+        uint32_t        m_BatchQueued;
+        uint32_t        m_BatchCoalesced;
+        uint32_t        m_BatchDispatched;
+        
+    private:
+        uint32_t Append(const Record& record);
+        void Deliver(const Record& record);
+    };
+    
+}
+
+#endif /* EVENTQUEUE_H */
@@ -17,6 +17,7 @@
 #define EVENTTYPES_H
 
 #include <coconuts/types.h>
+#include <cstdint>
 
 /* Log Output Event names */
 #define EVENT_NAME_WINDOW_RESIZE        "Event <WindowResize>"
@@ -66,6 +67,34 @@ namespace Coconuts
         Category_InputTouchEvent    = BIT_MASK(4)   /* RESERVED - Future usage */
     };
     
+    constexpr uint32_t EVENT_TYPE_COUNT = static_cast<uint32_t>(EventType::TouchRelease) + 1;
+    
+    /* Set of EventTypes, one bit per type (e.g. an Event Handler's subscriptions) */
+    using EventMask = uint32_t;
+    
+    constexpr EventMask EVENT_MASK_NONE = 0;
+    constexpr EventMask EVENT_MASK_ALL  = UINT32_MAX;
+    
+    constexpr EventMask EventMaskOf(EventType type)
+    {
+        return (EventMask) 1 << static_cast<uint32_t>(type);
+    }
+    
+    /* All the EventTypes in these categories (EventCategory flags) */
+    constexpr EventMask EventMaskOf(unsigned int categories)
+    {
+        return ((categories & Category_WindowEvent) ?
+                    EventMaskOf(EventType::WindowResize) | EventMaskOf(EventType::WindowClose) |
+                    EventMaskOf(EventType::WindowMinimize) : 0)
+             | ((categories & Category_InputKeyEvent) ?
+                    EventMaskOf(EventType::KeyPress) | EventMaskOf(EventType::KeyRelease) : 0)
+             | ((categories & Category_InputMouseEvent) ?
+                    EventMaskOf(EventType::MouseButtonPress) | EventMaskOf(EventType::MouseButtonRelease) |
+                    EventMaskOf(EventType::MouseCursorMove) | EventMaskOf(EventType::MouseScroll) : 0)
+             | ((categories & Category_InputTouchEvent) ?
+                    EventMaskOf(EventType::TouchPress) | EventMaskOf(EventType::TouchRelease) : 0);
+    }
+    
 #define IS_INPUT_EVENT(CATS)    ((CATS & Category_InputKeyEvent) || (CATS & Category_InputMouseEvent) || (CATS & Category_InputTouchEvent)) ? true:false
 #define IS_WINDOW_EVENT(CATS)   (CATS & Category_WindowEvent) ? true:false
 }
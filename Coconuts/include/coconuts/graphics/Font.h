@@ -0,0 +1,94 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FONT_H
+#define FONT_H
+
+#include <coconuts/graphics/Texture.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Coconuts
+{
+    
+    /**
+     * TrueType font rasterized once into a signed distance field atlas.
+     * Distances survive magnification, so one atlas serves every text size.
+     * Metrics are normalized: a size of 1.0 is one line of text.
+     */
+    class Font
+    {
+    public:
+        struct Glyph
+        {
+            glm::vec2   planeMin;   // quad corners relative to the pen (baseline), y up
+            glm::vec2   planeMax;
+            glm::vec2   uvMin;      // atlas coords of planeMin / planeMax corners
+            glm::vec2   uvMax;
+            float       advance;
+        };
+        
+        /* Laid out string at size 1.0, origin at the first baseline */
+        struct TextRun
+        {
+            std::vector<Glyph>  glyphs;     // visible glyphs only, planes already offset
+            glm::vec2           size;       // bounding width, number of lines
+        };
+        
+        ~Font();
+        
+        /**
+         * Rasterize codepoints [firstCodepoint, lastCodepoint] of a .ttf file.
+         * rasterHeight is the atlas' line height in pixels (quality, not on screen size).
+         */
+        static Font* Create(const std::string& ttfPath,
+                            float rasterHeight = 48.0f,
+                            uint32_t firstCodepoint = 32,
+                            uint32_t lastCodepoint = 126);
+        
+        /* Cached: laying out the same string again is a hash lookup */
+        const TextRun& GetTextRun(const std::string& text);
+        
+        const std::shared_ptr<Texture2D>& GetAtlas() const { return m_Atlas; }
+        float GetLineHeight() const { return m_LineHeight; }
+        const std::string& GetPath() const { return m_Path; }
+        
+    private:
+        Font() = default;
+        bool Init(float rasterHeight, uint32_t firstCodepoint, uint32_t lastCodepoint);
+        const Glyph* FindGlyph(uint32_t codepoint) const;
+        
+    private:
+        static const size_t MAX_CACHED_RUNS = 1024;
+        
+        std::string m_Path;
+        std::vector<unsigned char> m_TTF;
+        void* m_FontInfo = nullptr;     // stbtt_fontinfo (kept for kerning)
+        float m_Scale = 0.0f;           // font units -> normalized units
+        float m_LineHeight = 1.0f;
+        
+        uint32_t m_FirstCodepoint = 0;
+        std::vector<Glyph> m_Glyphs;    // indexed by codepoint - m_FirstCodepoint
+        std::shared_ptr<Texture2D> m_Atlas;
+        
+        std::unordered_map<std::string, TextRun> m_Runs;
+    };
+    
+}
+
+#endif /* FONT_H */
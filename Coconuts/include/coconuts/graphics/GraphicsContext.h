@@ -25,6 +25,10 @@ namespace Coconuts
         virtual void Init() = 0;
         virtual void SwapBuffers() = 0;
         
+        /* A context is current on one thread at a time */
+        virtual void MakeCurrent() = 0;
+        virtual void Release() = 0;
+        
     private:
         
     };
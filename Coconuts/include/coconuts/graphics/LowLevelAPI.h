@@ -18,6 +18,7 @@
 
 #include <coconuts/graphics/RendererAPI.h>
 #include <coconuts/graphics/VertexArray.h>
+#include <coconuts/graphics/RenderThread.h>
 #include <memory>
 
 namespace Coconuts
@@ -31,27 +32,30 @@ namespace Coconuts
         public:
             inline static void Init()
             {
-                s_RendererAPI->Init();
+                RenderThread::Submit([] { s_RendererAPI->Init(); });
             }
             
             inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
             {
-                s_RendererAPI->SetViewport(x, y, width, height);
+                RenderThread::Submit([x, y, width, height] { s_RendererAPI->SetViewport(x, y, width, height); });
             }
             
             inline static void SetClearColor(const glm::vec4& color)
             {
-                s_RendererAPI->SetClearColor(color);
+                glm::vec4 clearColor = color;
+                RenderThread::Submit([clearColor] { s_RendererAPI->SetClearColor(clearColor); });
             }
         
             inline static void Clear()
             {
-                s_RendererAPI->Clear();
+                RenderThread::Submit([] { s_RendererAPI->Clear(); });
             }
         
             inline static void DrawIndexed(const std::shared_ptr<VertexArray>&vertexArray, uint32_t indexCount = 0)
             {
-                s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+                /* Keeps vertexArray alive until executed */
+                std::shared_ptr<VertexArray> va = vertexArray;
+                RenderThread::Submit([va, indexCount] { s_RendererAPI->DrawIndexed(va, indexCount); });
             }
             
         private:
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MEMORYACCOUNTANT_H
+#define MEMORYACCOUNTANT_H
+
+#include <cstdint>
+#include <vector>
+
+namespace Coconuts
+{
+
+    enum class MemoryCategory : uint8_t
+    {
+        /* GPU */
+        Texture2D               = 0,
+        VertexBuffer            = 1,
+        IndexBuffer             = 2,
+        FramebufferAttachment   = 3,
+
+        /* CPU */
+        CPUStaging              = 4,
+
+        Count
+    };
+
+    struct MemoryRecord
+    {
+        const void*     owner;
+        MemoryCategory  category;
+        uint64_t        bytes;
+    };
+
+    /**
+     * Central bookkeeping of memory held by graphics resources.
+     * Each resource registers its size under its own address (owner) when
+     * allocated, updates it when reallocated and unregisters when destroyed.
+     */
+    class MemoryAccountant
+    {
+    public:
+        /* Register (or update) the size held by owner */
+        static void Track(const void* owner, MemoryCategory category, uint64_t bytes);
+        static void Untrack(const void* owner);
+
+        /* Queries */
+        static uint64_t GetBytes(const void* owner);
+        static uint64_t GetTotalBytes(MemoryCategory category);
+        static uint32_t GetCount(MemoryCategory category);
+        static uint64_t GetTotalGPUBytes();
+        static uint64_t GetTotalCPUBytes();
+        static std::vector<MemoryRecord> GetRecords();
+
+        /* Budgets (0 -> unlimited) */
+        static void SetBudget(MemoryCategory category, uint64_t bytes);
+        static uint64_t GetBudget(MemoryCategory category);
+        static bool IsOverBudget(MemoryCategory category);
+
+        static const char* GetCategoryName(MemoryCategory category);
+        static bool IsGPU(MemoryCategory category) { return category < MemoryCategory::CPUStaging; }
+    };
+
+}
+
+#endif /* MEMORYACCOUNTANT_H */
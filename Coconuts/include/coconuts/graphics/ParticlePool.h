@@ -0,0 +1,84 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef PARTICLEPOOL_H
+#define PARTICLEPOOL_H
+
+#include <coconuts/graphics/Texture.h>
+#include <coconuts/graphics/Sampler.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    struct ParticleProps
+    {
+        glm::vec2   velocity            = glm::vec2(0.0f, 1.0f);
+        glm::vec2   velocityVariation   = glm::vec2(0.5f);      // +/- per axis
+        glm::vec2   acceleration        = glm::vec2(0.0f);      // e.g. gravity
+        glm::vec4   colorBegin          = glm::vec4(1.0f);
+        glm::vec4   colorEnd            = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+        float       sizeBegin           = 0.05f;
+        float       sizeEnd             = 0.0f;
+        float       lifetime            = 1.0f;                 // seconds
+        float       lifetimeVariation   = 0.0f;                 // +/- seconds
+    };
+    
+    /**
+     * Live particles kept as structure of arrays (one stream per attribute),
+     * packed at [0, count). Update() runs a single SIMD pass over all streams;
+     * dead particles are then replaced by the last live one.
+     * Particles are drawn as axis aligned quads written straight into the
+     * Renderer2D batch.
+     */
+    class ParticlePool
+    {
+    public:
+        ParticlePool(uint32_t capacity);
+        ~ParticlePool();
+        
+        void Emit(uint32_t amount, const glm::vec2& position, const ParticleProps& props);
+        void Update(float seconds, const ParticleProps& props);
+        void Clear() { m_Count = 0; }
+        
+        /* Between Renderer2D::BeginScene / EndScene. texture nullptr -> flat colored quads */
+        void Submit(float z = 0.0f,
+                    const std::shared_ptr<Texture2D>& texture = nullptr,
+                    const std::shared_ptr<Sampler>& sampler = nullptr) const;
+        
+        uint32_t GetCount() const { return m_Count; }
+        uint32_t GetCapacity() const { return m_Capacity; }
+        
+    private:
+        float Random();     // [0, 1)
+        
+    private:
+        uint32_t m_Capacity;
+        uint32_t m_Count;
+        uint32_t m_RandomState;
+        
+        /* Streams (capacity rounded up to a whole SIMD lane group) */
+        std::vector<float> m_PositionX, m_PositionY;
+        std::vector<float> m_VelocityX, m_VelocityY;
+        std::vector<float> m_Life, m_InvLifetime;   // remaining seconds, 1 / total seconds
+        std::vector<float> m_Size;
+        std::vector<float> m_ColorR, m_ColorG, m_ColorB, m_ColorA;
+    };
+    
+}
+
+#endif /* PARTICLEPOOL_H */
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RENDERCOMMANDLIST_H
+#define RENDERCOMMANDLIST_H
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * A frame worth of recorded rendering work.
+     * Commands are closures placement-constructed into a block arena that is
+     * kept between frames, so recording does no heap allocation once the
+     * arena has grown to a frame's size. Execute() runs them in order and
+     * rewinds the arena.
+     */
+    class RenderCommandList
+    {
+    public:
+        static constexpr size_t BLOCK_SIZE = 256 * 1024;
+        
+        RenderCommandList() = default;
+        ~RenderCommandList();
+        
+        RenderCommandList(const RenderCommandList&) = delete;
+        RenderCommandList& operator=(const RenderCommandList&) = delete;
+        
+        template<typename F>
+        void Record(F&& fn)
+        {
+            using Fn = typename std::decay<F>::type;
+            
+            void* payload = Allocate(sizeof(Fn), alignof(Fn));
+            new (payload) Fn(std::forward<F>(fn));
+            
+            m_Commands.push_back({ &Invoke<Fn>, &Destroy<Fn>, payload });
+        }
+        
+        /* Raw storage living until the list is executed (e.g. vertex data copies) */
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+        
+        void Execute();
+        void Clear();   /* drop commands without running them */
+        
+        uint32_t GetCommandCount() const { return (uint32_t) m_Commands.size(); }
+        size_t GetArenaBytes() const { return m_ArenaBytes; }
+        
+    private:
+        struct Command
+        {
+            void (*invoke)(void*);
+            void (*destroy)(void*);
+            void* payload;
+        };
+        
+        struct Block
+        {
+            std::unique_ptr<uint8_t[]> data;
+            size_t size;
+        };
+        
+        template<typename Fn>
+        static void Invoke(void* payload) { (*static_cast<Fn*>(payload))(); }
+        
+        template<typename Fn>
+        static void Destroy(void* payload) { static_cast<Fn*>(payload)->~Fn(); }
+        
+        void Rewind();
+        
+        std::vector<Command> m_Commands;
+        std::vector<Block> m_Blocks;
+        size_t m_BlockIndex = 0;
+        size_t m_Offset = 0;
+        size_t m_ArenaBytes = 0;
+    };
+    
+}
+
+#endif /* RENDERCOMMANDLIST_H */
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RENDERTHREAD_H
+#define RENDERTHREAD_H
+
+#include <coconuts/graphics/RenderCommandList.h>
+#include <coconuts/window_system/Window.h>
+#include <functional>
+
+namespace Coconuts
+{
+    
+    struct RenderThreadStatistics
+    {
+        float gameWaitMs        = 0.0f;     /* game thread blocked on the render thread (last frame) */
+        float executeMs         = 0.0f;     /* render thread executing + presenting (last frame) */
+        uint32_t commandCount   = 0;        /* commands in the last executed list */
+        uint32_t syncCount      = 0;        /* Sync() calls in the last frame */
+    };
+    
+    /**
+     * Optional render thread owning the graphics context.
+     * While it runs, the game thread records graphics work for frame N into
+     * a command list (Submit) while the render thread executes and presents
+     * frame N-1. EndFrame() hands the list over.
+     *
+     * Everything that touches the graphics API goes through Submit (backend
+     * calls, which copy any data they are given) or through Sync (resource
+     * creation: runs on the render thread and blocks the caller until done).
+     * When the render thread is not running both simply execute in place.
+     *
+     * Runs in the game-only loop (StandaloneApp::StartGameNoEditor, --game).
+     * The editor loop stays single threaded on purpose: ImGui's backend and
+     * its multi-viewport windows make GL contexts current on the main thread
+     * themselves, and the game's framebuffer objects would not be shared
+     * with a second context.
+     *
+     * Only the game thread may record. Shader compilation (Attach*,
+     * DoneAttach) is expected to happen at Init, before Start().
+     */
+    class RenderThread
+    {
+    public:
+        /* Takes the window's context away from the calling thread */
+        static void Start(Window& window);
+        
+        /* Drains in-flight work and gives the context back to the calling thread */
+        static void Stop();
+        
+        static bool IsRunning();
+        
+        /* True when Submit would defer (running, called from the game thread) */
+        static bool IsRecording();
+        
+        template<typename F>
+        static void Submit(F&& fn)
+        {
+            if (!IsRecording())
+            {
+                fn();
+                return;
+            }
+            
+            GetRecordingList().Record(std::forward<F>(fn));
+        }
+        
+        /* Copies data into the recording list (returns data as is when not recording) */
+        static const void* Copy(const void* data, size_t size);
+        
+        /* Run on the render thread between frames and wait for it */
+        static void Sync(const std::function<void()>& job);
+        
+        /* Hand the recorded frame over (waits for the previous one to finish) */
+        static void EndFrame();
+        
+        static RenderThreadStatistics GetStatistics();
+        
+    private:
+        static RenderCommandList& GetRecordingList();
+    };
+    
+}
+
+#endif /* RENDERTHREAD_H */
@@ -22,6 +22,10 @@
 #include <coconuts/graphics/Shader.h>
 #include <coconuts/graphics/Texture.h>
 #include <coconuts/graphics/Sprite.h>
+#include <coconuts/graphics/Sampler.h>
+#include <coconuts/graphics/Font.h>
+#include <unordered_map>
+#include <array>
 
 /* Cameras */
 #include <coconuts/cameras/OrthographicCamera.h>
@@ -56,7 +60,12 @@ namespace Coconuts
         
         /* Texture Slots */
         std::array<std::shared_ptr<Texture2D>, maxTextureSlots> textureSlots; 
+        /* Sampler bound along each texture slot (nullptr -> texture's own sampling) */
+        std::array<std::shared_ptr<Sampler>, maxTextureSlots> samplerSlots;
+        /* Texture slot holds a signed distance field (font atlas) */
+        std::array<bool, maxTextureSlots> distanceFieldSlots;
         const uint32_t minTextureSlotIndex  = 1; // '0' os reserved for blank/default texture
+        static const uint32_t cachedQuadsTextureSlot = 1;   // texIndex baked in cached (pre-built) quads
         /* Init slot index counter */
         uint32_t textureSlotsIndex = minTextureSlotIndex;
       
@@ -81,8 +90,12 @@ namespace Coconuts
         
         std::shared_ptr<VertexArray>    vertexArray;
         std::shared_ptr<VertexBuffer>   vertexBuffer;
+        std::shared_ptr<IndexBuffer>    quadIndexBuffer;    // maxQuads worth of indices, shared with cached quads
         std::shared_ptr<Shader>         shader;
         std::shared_ptr<Texture2D>      texture2D_Blank;
+        
+        /* Sampler objects cache (by SamplerSpecification key) */
+        std::unordered_map<uint64_t, std::shared_ptr<Sampler>> samplers;
     };
     
     class Renderer2D
@@ -136,33 +149,111 @@ namespace Coconuts
                              const glm::vec2& size,
                              const std::shared_ptr<Sprite>& sprite,
                              float tilingFactor = 1.0f,
-                             const glm::vec4& tintColor = glm::vec4(1.0f));
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
         
         static void DrawQuad(const glm::vec3& position,
                              const glm::vec2& size,
                              const std::shared_ptr<Sprite>& sprite,
                              float tilingFactor = 1.0f,
-                             const glm::vec4& tintColor = glm::vec4(1.0f));
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
         
         static void DrawRotatedQuad(const glm::vec2& position,
                              const glm::vec2& size,
                              float rotation_radians,
                              const std::shared_ptr<Sprite>& sprite,
                              float tilingFactor = 1.0f,
-                             const glm::vec4& tintColor = glm::vec4(1.0f));
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
         
         static void DrawRotatedQuad(const glm::vec3& position,
                              const glm::vec2& size,
                              float rotation_radians,
                              const std::shared_ptr<Sprite>& sprite,
                              float tilingFactor = 1.0f,
-                             const glm::vec4& tintColor = glm::vec4(1.0f));
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
         
+        /* Texture regions (4 texture coordinates, e.g. an animation frame) */
+        static void DrawRotatedQuad(const glm::vec3& position,
+                             const glm::vec2& size,
+                             float rotation_radians,
+                             const std::shared_ptr<Texture2D>& texture,
+                             const glm::vec2* textureCoords,
+                             float tilingFactor = 1.0f,
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
+        
+        /* World matrices (e.g. from a TransformHierarchy): transform maps the unit quad */
+        static void DrawQuad(const glm::mat4& transform,
+                             const std::shared_ptr<Texture2D>& texture,
+                             const glm::vec2* textureCoords,
+                             float tilingFactor = 1.0f,
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
+        
+        static void DrawQuad(const glm::mat4& transform,
+                             const std::shared_ptr<Sprite>& sprite,
+                             float tilingFactor = 1.0f,
+                             const glm::vec4& tintColor = glm::vec4(1.0f),
+                             const std::shared_ptr<Sampler>& sampler = nullptr);
+        
+        /**
+         * Text: glyph quads go into the regular batch (the font atlas takes a
+         * single texture slot), position is the first line's baseline and
+         * size the line height.
+         */
+        static void DrawString(const std::string& text,
+                               const std::shared_ptr<Font>& font,
+                               const glm::vec2& position,
+                               float size,
+                               const glm::vec4& color = glm::vec4(1.0f));
+        
+        static void DrawString(const std::string& text,
+                               const std::shared_ptr<Font>& font,
+                               const glm::vec3& position,
+                               float size,
+                               const glm::vec4& color = glm::vec4(1.0f));
+        
+        /**
+         * Cached quads: vertices built once (e.g. tilemap chunks) and kept in
+         * a VertexArray using GetQuadVertexLayout() and GetQuadIndexBuffer().
+         * Their texIndex must be BatchRender::cachedQuadsTextureSlot.
+         * The current batch is flushed first so draw order is preserved.
+         */
+        static void DrawCachedQuads(const std::shared_ptr<VertexArray>& vertexArray,
+                                    uint32_t quadCount,
+                                    const std::shared_ptr<Texture2D>& texture,
+                                    const std::shared_ptr<Sampler>& sampler = nullptr);
+        
+        /**
+         * Contiguous block of up to 'count' quads in the current batch, for
+         * callers writing QuadVertex data themselves (e.g. particles).
+         * Returns how many quads were reserved (the batch may be nearly full);
+         * call again for the remainder. texture nullptr -> blank texture.
+         * distanceField: texture alpha is a signed distance field (see Font).
+         */
+        static uint32_t ReserveQuads(uint32_t count,
+                                     QuadVertex*& vertices,
+                                     float& textureIndex,
+                                     const std::shared_ptr<Texture2D>& texture = nullptr,
+                                     const std::shared_ptr<Sampler>& sampler = nullptr,
+                                     bool distanceField = false);
+        
+        static BufferLayout GetQuadVertexLayout();
+        static std::shared_ptr<IndexBuffer> GetQuadIndexBuffer();
         
         static std::shared_ptr<Texture2D> GetDefaultMissingSpriteTexture() { return s_WarningMissingSpriteTexture; }
         
+        /* Shared Sampler object for a given specification (created on first request) */
+        static std::shared_ptr<Sampler> GetSampler(const SamplerSpecification& spec);
+        
     private:
         static void FlushAndReset();
+        static float GetTextureSlotIndex(const std::shared_ptr<Texture2D>& texture,
+                                         const std::shared_ptr<Sampler>& sampler,
+                                         bool distanceField = false);
         
     private:
         static std::shared_ptr<Texture2D> s_WarningMissingSpriteTexture;
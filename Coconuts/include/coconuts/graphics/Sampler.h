@@ -0,0 +1,86 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include <cstdint>
+
+namespace Coconuts
+{
+
+    enum class TextureFilter : uint8_t
+    {
+        Nearest = 0,
+        Linear  = 1
+    };
+
+    enum class TextureWrap : uint8_t
+    {
+        Repeat          = 0,
+        MirroredRepeat  = 1,
+        ClampToEdge     = 2
+    };
+
+    struct SamplerSpecification
+    {
+        TextureFilter   minFilter       = TextureFilter::Linear;
+        TextureFilter   magFilter       = TextureFilter::Nearest;
+        TextureFilter   mipFilter       = TextureFilter::Linear;    // between mip levels
+        bool            mipmaps         = true;                     // sample the mip chain when minifying
+        TextureWrap     wrapS           = TextureWrap::Repeat;
+        TextureWrap     wrapT           = TextureWrap::Repeat;
+        float           maxAnisotropy   = 1.0f;                     // 1.0 -> disabled
+
+        /* Unique key (handy for caching) */
+        uint64_t GetKey() const
+        {
+            uint32_t anisotropy = (uint32_t) (maxAnisotropy * 16.0f);
+
+            return  ((uint64_t) minFilter)          |
+                    ((uint64_t) magFilter   << 2)   |
+                    ((uint64_t) mipFilter   << 4)   |
+                    ((uint64_t) mipmaps     << 6)   |
+                    ((uint64_t) wrapS       << 8)   |
+                    ((uint64_t) wrapT       << 12)  |
+                    ((uint64_t) anisotropy  << 16);
+        }
+
+        bool operator == (const SamplerSpecification& other) const { return GetKey() == other.GetKey(); }
+    };
+
+    /**
+     * Sampling state decoupled from texture data.
+     * A Sampler bound to a texture unit overrides the sampling parameters
+     * of whatever texture is bound to that same unit.
+     */
+    class Sampler
+    {
+    public:
+        virtual ~Sampler() = default;
+
+        virtual void Bind(uint32_t slot = 0) const = 0;
+
+        virtual const SamplerSpecification& GetSpecification() const = 0;
+
+        /* Back to each texture's own sampling parameters */
+        static void Unbind(uint32_t slot = 0);
+
+        static Sampler* Create(const SamplerSpecification& spec);
+    };
+
+}
+
+#endif /* SAMPLER_H */
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SPRITEANIMATIONCLIP_H
+#define SPRITEANIMATIONCLIP_H
+
+#include <coconuts/graphics/Texture.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Flipbook animation over a sprite sheet grid.
+     * Texture coordinates of every frame are computed once and stored
+     * contiguously (4 per frame), so playback is a plain table lookup.
+     */
+    class SpriteAnimationClip
+    {
+    public:
+        /* How a clip was laid out on its sprite sheet (what gets saved) */
+        struct FrameGrid
+        {
+            glm::vec2   firstCoords;
+            glm::vec2   cellSize;
+            glm::vec2   spriteSize;
+            uint32_t    framesPerRow;
+            float       framesPerSecond;
+        };
+        
+        /**
+         * Frames are read from the sprite sheet grid (same units as a
+         * Sprite's coords / cellSize / spriteSize) starting at firstCoords,
+         * left to right, wrapping to the next row after framesPerRow frames.
+         * framesPerRow == 0 -> whole sheet width.
+         */
+        static SpriteAnimationClip* Create(const std::shared_ptr<Texture2D>& spriteSheet,
+                                           const glm::vec2& firstCoords,
+                                           const glm::vec2& cellSize,
+                                           uint32_t frameCount,
+                                           float framesPerSecond,
+                                           bool loop = true,
+                                           uint32_t framesPerRow = 0,
+                                           const glm::vec2& spriteSize = glm::vec2(1.0f));
+        
+        const std::shared_ptr<Texture2D>& GetTexture() const { return m_Texture; }
+        /* Out of range frames wrap around (a clip is never empty, see Create) */
+        const glm::vec2* GetTextureCoords(uint32_t frame) const { return &m_TexCoords[(frame % m_FrameCount) * 4]; }
+        uint32_t GetFrameCount() const { return m_FrameCount; }
+        const FrameGrid& GetFrameGrid() const { return m_Grid; }
+        float GetFrameDuration() const { return m_FrameDuration; }
+        bool IsLooping() const { return m_Loop; }
+        
+    private:
+        SpriteAnimationClip(const std::shared_ptr<Texture2D>& spriteSheet,
+                            const std::vector<glm::vec2>& texCoords,
+                            const FrameGrid& grid,
+                            bool loop);
+        
+    private:
+        std::shared_ptr<Texture2D> m_Texture;
+        std::vector<glm::vec2> m_TexCoords;
+        uint32_t m_FrameCount;
+        FrameGrid m_Grid;
+        float m_FrameDuration;  // seconds
+        bool m_Loop;
+    };
+    
+}
+
+#endif /* SPRITEANIMATIONCLIP_H */
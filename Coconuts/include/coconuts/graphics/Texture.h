@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <coconuts/graphics/Sampler.h>
 
 namespace Coconuts
 {
@@ -32,10 +33,17 @@ namespace Coconuts
         virtual uint32_t GetWidth() const = 0;
         virtual uint32_t GetHeight() const = 0;
         
+        /* Size of the texture image data in bytes (whole mip chain) */
+        virtual uint64_t GetSizeBytes() const = 0;
+        
         virtual void SetData(void* data, uint32_t size) = 0;
         
         virtual void Bind(uint32_t slot = 0) const = 0;
         
+        /* Texture's own sampling (used when no Sampler is bound to its unit) */
+        virtual void SetSampling(const SamplerSpecification& spec) = 0;
+        virtual const SamplerSpecification& GetSampling() const = 0;
+        
         virtual bool operator == (const Texture& other) const = 0;
         
         virtual explicit operator void*() const = 0;
@@ -51,6 +59,12 @@ namespace Coconuts
         static Texture2D* Create(uint32_t width, uint32_t height, void* data, uint32_t size);
         static Texture2D* Create(const std::string& path);
         
+        /* From an image file already read into memory (encoded, e.g. PNG) */
+        static Texture2D* Create(const std::string& path, const void* encoded, uint64_t size);
+        
+        /* From already decoded (cooked) pixels, e.g. mapped from a .ccnpak archive */
+        static Texture2D* Create(const std::string& path, uint32_t width, uint32_t height, uint32_t channels, const void* pixels);
+        
     protected:
         virtual bool IsValid() = 0;
     };
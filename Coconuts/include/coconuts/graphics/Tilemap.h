@@ -0,0 +1,103 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include <coconuts/graphics/Texture.h>
+#include <coconuts/graphics/Sampler.h>
+#include <coconuts/graphics/VertexArray.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Grid of tile indices into a tileset (sprite sheet) texture.
+     * Tiles are grouped in square chunks whose quads are built once, kept in
+     * GPU buffers and only rebuilt when one of their tiles changes.
+     * Tile i maps to tileset cell (i % columns, i / columns), counted from the
+     * bottom-left cell like Sprite coords.
+     */
+    class Tilemap
+    {
+    public:
+        static const uint32_t CHUNK_TILES = 32;      // tiles per chunk side
+        static const uint16_t EMPTY_TILE = 0xFFFF;
+        
+        Tilemap(uint32_t width, uint32_t height, const glm::vec2& tileSize = glm::vec2(1.0f));
+        
+        void SetTileset(const std::shared_ptr<Texture2D>& tileset, const glm::vec2& cellSize);
+        const std::shared_ptr<Texture2D>& GetTileset() const { return m_Tileset; }
+        const glm::vec2& GetCellSize() const { return m_CellSize; }
+        
+        void SetTile(uint32_t x, uint32_t y, uint16_t tile);
+        uint16_t GetTile(uint32_t x, uint32_t y) const;
+        
+        /* Row-major, bottom row first. Size must be width * height */
+        bool SetTiles(const std::vector<uint16_t>& tiles);
+        const std::vector<uint16_t>& GetTiles() const { return m_Tiles; }
+        
+        void SetTileSize(const glm::vec2& tileSize);
+        void SetTintColor(const glm::vec4& tintColor);
+        
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+        const glm::vec2& GetTileSize() const { return m_TileSize; }
+        const glm::vec4& GetTintColor() const { return m_TintColor; }
+        
+        /**
+         * Submit chunks overlapping the view of viewProj to Renderer2D
+         * (between BeginScene / EndScene). origin is the world position of the
+         * bottom-left corner of tile (0, 0). Dirty chunks are rebuilt on the way.
+         */
+        void Draw(const glm::vec2& origin,
+                  const glm::mat4& viewProj,
+                  const std::shared_ptr<Sampler>& sampler = nullptr);
+        
+    private:
+        struct Chunk
+        {
+            std::shared_ptr<VertexArray>    vertexArray;
+            std::shared_ptr<VertexBuffer>   vertexBuffer;
+            uint32_t                        quadCount   = 0;
+            bool                            dirty       = true;
+        };
+        
+        void BuildChunk(uint32_t chunkX, uint32_t chunkY);
+        void MarkAllDirty();
+        
+    private:
+        uint32_t m_Width;
+        uint32_t m_Height;
+        glm::vec2 m_TileSize;
+        glm::vec4 m_TintColor;
+        std::vector<uint16_t> m_Tiles;
+        
+        std::shared_ptr<Texture2D> m_Tileset;
+        glm::vec2 m_CellSize;
+        
+        /* GPU cache */
+        uint32_t m_ChunksX;
+        uint32_t m_ChunksY;
+        std::vector<Chunk> m_Chunks;
+        glm::vec2 m_BuiltOrigin;
+    };
+    
+}
+
+#endif /* TILEMAP_H */
@@ -8,30 +8,45 @@ in float v_TexIndex;
 in float v_TilingFactor;
 
 uniform sampler2D u_Textures[16];
+uniform int u_SdfMask;  // bit i set -> u_Textures[i] is a signed distance field (text)
 
 void main()
 {
     int idx = int(v_TexIndex);
+    vec4 texel;
 
     // Done this way to avoid 'Dynamic Indexing' errors on older drivers
     switch(idx)
     {
-    case 15: color = texture(u_Textures[15], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case 14: color = texture(u_Textures[14], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case 13: color = texture(u_Textures[13], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case 12: color = texture(u_Textures[12], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case 11: color = texture(u_Textures[11], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case 10: color = texture(u_Textures[10], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  9: color = texture(u_Textures[9], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  8: color = texture(u_Textures[8], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  7: color = texture(u_Textures[7], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  6: color = texture(u_Textures[6], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  5: color = texture(u_Textures[5], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  4: color = texture(u_Textures[4], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  3: color = texture(u_Textures[3], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  2: color = texture(u_Textures[2], v_TexCoord * v_TilingFactor) * v_Color; break;
-    case  1: color = texture(u_Textures[1], v_TexCoord * v_TilingFactor) * v_Color; break;
+    case 15: texel = texture(u_Textures[15], v_TexCoord * v_TilingFactor); break;
+    case 14: texel = texture(u_Textures[14], v_TexCoord * v_TilingFactor); break;
+    case 13: texel = texture(u_Textures[13], v_TexCoord * v_TilingFactor); break;
+    case 12: texel = texture(u_Textures[12], v_TexCoord * v_TilingFactor); break;
+    case 11: texel = texture(u_Textures[11], v_TexCoord * v_TilingFactor); break;
+    case 10: texel = texture(u_Textures[10], v_TexCoord * v_TilingFactor); break;
+    case  9: texel = texture(u_Textures[9], v_TexCoord * v_TilingFactor); break;
+    case  8: texel = texture(u_Textures[8], v_TexCoord * v_TilingFactor); break;
+    case  7: texel = texture(u_Textures[7], v_TexCoord * v_TilingFactor); break;
+    case  6: texel = texture(u_Textures[6], v_TexCoord * v_TilingFactor); break;
+    case  5: texel = texture(u_Textures[5], v_TexCoord * v_TilingFactor); break;
+    case  4: texel = texture(u_Textures[4], v_TexCoord * v_TilingFactor); break;
+    case  3: texel = texture(u_Textures[3], v_TexCoord * v_TilingFactor); break;
+    case  2: texel = texture(u_Textures[2], v_TexCoord * v_TilingFactor); break;
+    case  1: texel = texture(u_Textures[1], v_TexCoord * v_TilingFactor); break;
     case  0:
-    default: color = texture(u_Textures[0], v_TexCoord * v_TilingFactor) * v_Color; break;
+    default: texel = texture(u_Textures[0], v_TexCoord * v_TilingFactor); break;
+    }
+
+    if (((u_SdfMask >> idx) & 1) != 0)
+    {
+        // Distance 0.5 is the glyph edge: antialias over one screen pixel
+        float dist = texel.a;
+        float width = fwidth(dist);
+        float alpha = smoothstep(0.5 - width, 0.5 + width, dist);
+        color = vec4(v_Color.rgb, v_Color.a * alpha);
+    }
+    else
+    {
+        color = texel * v_Color;
     }
 }
\ No newline at end of file
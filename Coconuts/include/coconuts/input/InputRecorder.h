@@ -0,0 +1,64 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include <coconuts/input/InputSnapshot.h>
+#include <string>
+
+namespace Coconuts
+{
+    
+    /**
+     * Records the InputState captured every frame by Polling::Capture(),
+     * with that frame's timestep, into a tape. Replays a tape instead of
+     * the devices and the clock: the same states and frame times give a
+     * Scene the same simulation steps, so runs are deterministic
+     * (benchmarks, bug reproduction).
+     * Main thread only.
+     */
+    class InputRecorder
+    {
+    public:
+        /* Starts a new tape */
+        static void StartRecording();
+        static void StopRecording();
+        static bool IsRecording();
+        
+        /**
+         * Polling reads the tape from its first frame on.
+         * At the end it loops, or returns to the devices.
+         * False for an empty tape.
+         */
+        static bool StartReplay(bool loop = false);
+        static void StopReplay();
+        static bool IsReplaying();
+        
+        static size_t GetFrameCount();
+        static void Clear();
+        
+        /* Binary tape files */
+        static bool Save(const std::string& filepath);
+        static bool Load(const std::string& filepath);
+        
+        /* Polling::Capture() */
+        static bool NextFrame(InputState& state, float& frameSeconds);   /* false if not replaying */
+        static void Record(const InputState& state, float frameSeconds);
+    };
+    
+}
+
+#endif /* INPUTRECORDER_H */
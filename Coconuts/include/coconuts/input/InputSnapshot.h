@@ -0,0 +1,79 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INPUTSNAPSHOT_H
+#define INPUTSNAPSHOT_H
+
+#include <coconuts/Keyboard.h>
+#include <bitset>
+#include <cstdint>
+
+namespace Coconuts
+{
+    
+    /* Raw device state at one instant: what is polled, recorded and replayed */
+    struct InputState
+    {
+        static constexpr uint32_t KEY_COUNT     = Keyboard::KEY_MENU + 1;  /* GLFW_KEY_LAST + 1 */
+        static constexpr uint32_t BUTTON_COUNT  = 8;                       /* GLFW_MOUSE_BUTTON_LAST + 1 */
+        
+        std::bitset<KEY_COUNT>      keys;       /* down, by key code */
+        std::bitset<BUTTON_COUNT>   buttons;    /* down, by button code */
+        double                      mouseX = 0.0;
+        double                      mouseY = 0.0;
+    };
+    
+    /**
+     * One frame of input: the state captured at its start and how it
+     * changed since the previous frame (edges, cursor delta).
+     * Every query is a bit test: no window system call.
+     */
+    struct InputSnapshot
+    {
+        InputState                              state;
+        std::bitset<InputState::KEY_COUNT>      keysPressed;        /* went down this frame */
+        std::bitset<InputState::KEY_COUNT>      keysReleased;       /* went up this frame */
+        std::bitset<InputState::BUTTON_COUNT>   buttonsPressed;
+        std::bitset<InputState::BUTTON_COUNT>   buttonsReleased;
+        double                                  deltaX = 0.0;
+        double                                  deltaY = 0.0;
+        uint64_t                                frame  = 0;         /* snapshots taken */
+        bool                                    held   = false;     /* edges carried into the next Advance */
+        
+        /* Moves to the next frame's state (merging held edges and deltas) */
+        void Advance(const InputState& next);
+        
+        /* Edges and deltas were seen: none left for the rest of this frame */
+        void Consume();
+        
+        /* Edges and deltas weren't seen yet: keep them through the next Advance */
+        void Hold() { held = true; }
+        
+        bool IsKeyDown(int key) const               { return IsKey(key) && state.keys.test(key); }
+        bool WasKeyPressed(int key) const           { return IsKey(key) && keysPressed.test(key); }
+        bool WasKeyReleased(int key) const          { return IsKey(key) && keysReleased.test(key); }
+        
+        bool IsButtonDown(int button) const         { return IsButton(button) && state.buttons.test(button); }
+        bool WasButtonPressed(int button) const     { return IsButton(button) && buttonsPressed.test(button); }
+        bool WasButtonReleased(int button) const    { return IsButton(button) && buttonsReleased.test(button); }
+        
+    private:
+        static bool IsKey(int key)          { return (uint32_t) key < InputState::KEY_COUNT; }
+        static bool IsButton(int button)    { return (uint32_t) button < InputState::BUTTON_COUNT; }
+    };
+    
+}
+
+#endif /* INPUTSNAPSHOT_H */
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    using JobFunction = std::function<void()>;
+    
+    /**
+     * Counts unfinished jobs.
+     * Each job scheduled with a counter increments it and decrements it when
+     * done. Jobs scheduled with a counter as their dependency only start once
+     * it reaches zero.
+     */
+    class JobCounter
+    {
+        friend class JobSystem;
+        
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+        
+        uint32_t GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+        bool IsDone() const { return GetPending() == 0; }
+        
+    private:
+        struct Continuation
+        {
+            JobFunction     function;
+            JobCounter*     counter;
+            const char*     name;
+        };
+        
+        std::atomic<uint32_t>       m_Pending {0};
+        std::mutex                  m_Guard;
+        std::vector<Continuation>   m_Continuations;    /* waiting on this counter */
+    };
+    
+    /**
+     * Engine wide thread pool.
+     * Every worker (and the main thread, index 0) owns a deque: it pushes and
+     * pops its own jobs LIFO (cache warm) and idle workers steal the oldest
+     * job from the others. Threads waiting on a counter execute jobs in the
+     * meantime instead of blocking.
+     */
+    class JobSystem
+    {
+    public:
+        /* 0 -> one worker per hardware thread, minus the main thread */
+        static void Init(uint32_t workerCount = 0);
+        static void Shutdown();
+        
+        static bool IsInitialized();
+        static uint32_t GetWorkerCount();
+        
+        /* 0 on the main thread (or any non worker thread), 1..N on workers */
+        static uint32_t GetThreadIndex();
+        
+        static void Schedule(const JobFunction& job,
+                             JobCounter* counter = nullptr,
+                             JobCounter* dependency = nullptr,
+                             const char* name = "Job");
+        
+        /* Runs other jobs until counter reaches zero */
+        static void Wait(JobCounter& counter);
+        
+        /* Executes one queued job on the calling thread. False if none was queued */
+        static bool RunOne();
+        
+        /**
+         * Splits [0, count) in ranges of grainSize (0 -> automatic) and calls
+         * fn(begin, end) for each, in parallel. Returns when all are done.
+         */
+        static void ParallelFor(uint32_t count, uint32_t grainSize,
+                                const std::function<void(uint32_t begin, uint32_t end)>& fn,
+                                const char* name = "ParallelFor");
+        
+    private:
+        struct Job;
+        friend struct WorkQueue;    /* holds Jobs by value */
+        
+        static void Push(Job&& job);
+        static bool Pop(Job& job);
+        static void Execute(Job& job);
+        static void Complete(JobCounter* counter);
+        static void WorkerLoop(uint32_t index);
+    };
+    
+}
+
+#endif /* JOBSYSTEM_H */
@@ -30,6 +30,11 @@ namespace Coconuts
         private:
             /* Entity handlers */
             Entity m_Entity;
+            
+            /* Play mode: the edited Scene, set aside while a clone of it runs */
+            std::shared_ptr<Scene> m_EditedScene;
+            std::weak_ptr<Scene> m_PlayingScene;
+            uint16_t m_PlayingSceneID;
 
         public:
             GameLayer();
@@ -54,8 +59,13 @@ namespace Coconuts
             /* Change on viewport notification */
             void ChangeViewport(float x, float y);
             
+            std::shared_ptr<Scene> GetActiveScene() const;
             bool IsActiveSceneUpdated();
+            uint64_t GetActiveSceneStructureVersion() const;
             std::vector<Entity> GetActiveSceneEntities() const;
+            EntityList& GetActiveSceneEntityList() const;
+            ChangeTracker& GetActiveSceneChangeTracker() const;
+            Entity GetActiveSceneEntity(uint64_t id) const;
             
             /* Create New Empty Entity on current active Scene */
             bool NewEntity();
@@ -66,6 +76,15 @@ namespace Coconuts
             /* Get Active Scene's aspect ratio */
             float GetActiveSceneAR();
             
+            /**
+             * Play mode.
+             * BeginPlay() runs a clone of the active Scene in its place;
+             * EndPlay() drops the clone and puts the edited Scene back, as it was.
+             */
+            bool BeginPlay();
+            bool EndPlay();
+            bool IsPlaying() const { return m_EditedScene != nullptr; }
+            
             // --------------------------------------
             // Debug Color change
             Entity& GetEntity() {return m_Entity; }
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace Coconuts
+{
+    
+    /**
+     * High resolution monotonic clock.
+     * Never jumps backwards (unlike wall time) and keeps nanosecond ticks as
+     * integers, so long sessions don't lose precision the way a float
+     * seconds counter does.
+     */
+    class Clock
+    {
+    public:
+        static int64_t NowNanoseconds()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+        
+        static double NowSeconds()
+        {
+            return NanosecondsToSeconds(NowNanoseconds());
+        }
+        
+        static double NanosecondsToSeconds(int64_t ns)
+        {
+            return (double) ns * 1.0e-9;
+        }
+        
+        static int64_t SecondsToNanoseconds(double seconds)
+        {
+            return (int64_t) (seconds * 1.0e9);
+        }
+    };
+    
+}
+
+#endif /* CLOCK_H */
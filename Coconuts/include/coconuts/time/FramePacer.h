@@ -0,0 +1,67 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <cstdint>
+
+namespace Coconuts
+{
+    
+    /* Frame times over the last FramePacer::HISTORY_SIZE frames */
+    struct FramePacerStatistics
+    {
+        float lastFrameMs       = 0.0f;
+        float averageFrameMs    = 0.0f;
+        float minFrameMs        = 0.0f;
+        float maxFrameMs        = 0.0f;
+        float percentile99Ms    = 0.0f;
+        float jitterMs          = 0.0f;     /* standard deviation */
+        float averageSleepMs    = 0.0f;
+        float averageSpinMs     = 0.0f;
+        uint32_t missedDeadlines = 0;       /* since the target was last set */
+    };
+    
+    /**
+     * Caps the main loop to a target frame rate.
+     * EndFrame() is called once per frame, after presenting. It sleeps for
+     * most of the time left until the next deadline and spins (yielding)
+     * through the last SpinThreshold, since OS sleeps overshoot by up to a
+     * scheduler tick. Deadlines advance by a fixed period, so a slightly late
+     * frame doesn't push every following frame later.
+     */
+    class FramePacer
+    {
+    public:
+        static constexpr uint32_t HISTORY_SIZE = 240;
+        
+        /* 0 -> unlimited (only frame times are recorded) */
+        static void SetTargetFPS(float fps);
+        static float GetTargetFPS();
+        
+        /* How long before the deadline to stop sleeping and start spinning */
+        static void SetSpinThreshold(float milliseconds);
+        static float GetSpinThreshold();
+        
+        static void EndFrame();
+        
+        static FramePacerStatistics GetStatistics();
+        static void ResetStatistics();
+    };
+    
+}
+
+#endif /* FRAMEPACER_H */
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Hierarchical timer wheel over integer ticks.
+     * LEVELS wheels of 64 slots: level 0 holds timers due in the next 64
+     * ticks, level 1 in the next 64^2, ... Timers cascade down a level as
+     * time gets closer, so scheduling is O(1) and advancing only touches
+     * timers that are (nearly) due, never all pending ones.
+     * Timers further than 64^LEVELS ticks away wait on the top level.
+     */
+    template <typename T>
+    class TimerWheel
+    {
+    public:
+        static constexpr uint32_t LEVELS     = 4;
+        static constexpr uint32_t SLOT_BITS  = 6;
+        static constexpr uint32_t SLOTS      = 1u << SLOT_BITS;
+        static constexpr uint32_t SLOT_MASK  = SLOTS - 1;
+        
+        TimerWheel() : m_Now(0), m_Count(0) {}
+        
+        uint64_t GetNow() const { return m_Now; }
+        size_t GetCount() const { return m_Count; }
+        
+        /* Due in the past or now -> fires on the next Advance() */
+        void Schedule(uint64_t dueTick, const T& value)
+        {
+            Insert({ (dueTick > m_Now) ? dueTick : m_Now + 1, value });
+            m_Count++;
+        }
+        
+        /* Moves time forward to tick, calling fire(value) for every timer due */
+        template <typename Function>
+        void Advance(uint64_t tick, Function fire)
+        {
+            while (m_Now < tick)
+            {
+                /* Nothing scheduled: jump */
+                if (m_Count == 0)
+                {
+                    m_Now = tick;
+                    return;
+                }
+                
+                m_Now++;
+                
+                /* Level 0 wrapped: bring the next block of timers down */
+                for (uint32_t level = 1; level < LEVELS; level++)
+                {
+                    if (((m_Now >> (SLOT_BITS * (level - 1))) & SLOT_MASK) != 0)
+                    {
+                        break;
+                    }
+                    Cascade(level, (m_Now >> (SLOT_BITS * level)) & SLOT_MASK);
+                }
+                
+                std::vector<Timer>& slot = m_Wheels[0][m_Now & SLOT_MASK];
+                if (slot.empty())
+                {
+                    continue;
+                }
+                
+                /* fire() may schedule new timers (even in this slot) */
+                m_Firing.clear();
+                m_Firing.swap(slot);
+                m_Count -= m_Firing.size();
+                
+                for (Timer& timer : m_Firing)
+                {
+                    fire(timer.value);
+                }
+            }
+        }
+        
+    private:
+        struct Timer
+        {
+            uint64_t    due;
+            T           value;
+        };
+        
+        std::vector<Timer>  m_Wheels[LEVELS][SLOTS];
+        std::vector<Timer>  m_Firing;
+        uint64_t            m_Now;
+        size_t              m_Count;
+        
+    private:
+        void Insert(const Timer& timer)
+        {
+            uint64_t delta = timer.due - m_Now;
+            
+            for (uint32_t level = 0; level < LEVELS; level++)
+            {
+                if (delta < (1ull << (SLOT_BITS * (level + 1))) || level == LEVELS - 1)
+                {
+                    uint64_t due = timer.due;
+                    
+                    /* Beyond the top level's reach: park it on its furthest slot */
+                    if (level == LEVELS - 1 && delta >= (1ull << (SLOT_BITS * LEVELS)))
+                    {
+                        due = m_Now + (1ull << (SLOT_BITS * LEVELS)) - 1;
+                    }
+                    
+                    m_Wheels[level][(due >> (SLOT_BITS * level)) & SLOT_MASK].push_back(timer);
+                    return;
+                }
+            }
+        }
+        
+        void Cascade(uint32_t level, uint64_t index)
+        {
+            std::vector<Timer> timers;
+            timers.swap(m_Wheels[level][index]);
+            
+            for (const Timer& timer : timers)
+            {
+                Insert(timer);
+            }
+        }
+    };
+    
+}
+
+#endif /* TIMERWHEEL_H */
@@ -36,6 +36,13 @@ namespace Coconuts
         }
     };
     
+    enum class VSyncMode : uint8_t
+    {
+        Off         = 0,    /* swap immediately (tearing) */
+        On          = 1,    /* wait for vertical blank */
+        Adaptive    = 2     /* wait, unless the frame is late (tears instead of stalling) */
+    };
+    
     class Window
     {
     public:
@@ -43,13 +50,27 @@ namespace Coconuts
         
         virtual ~Window() = default;
         
-        /* Called once per frame */
+        /* Called once per frame (SwapBuffers + PollEvents + DispatchEvents) */
         virtual void OnUpdate() = 0;
         
+        /* Split OnUpdate, for when presenting happens on the render thread */
+        virtual void SwapBuffers() = 0;
+        
+        /* Queues the window manager's events: nothing is dispatched yet */
+        virtual void PollEvents() = 0;
+        
+        /* Dispatches the queued (and coalesced) events to the event callback, in one batch */
+        virtual void DispatchEvents() = 0;
+        virtual const EventQueueStatistics& GetEventStatistics() const = 0;
+        
+        /* Move the graphics context to / away from the calling thread */
+        virtual void AttachContext() = 0;
+        virtual void DetachContext() = 0;
+        
         /* MUST be implemented by a platform dependent sub Window class */
         virtual void SetEventCallback(const EventCallbackFunction& callbackFn) = 0;
         
-        /* Propagates a manually triggered event */
+        /* Propagates a manually triggered event (immediately, not queued) */
         virtual void EventTrigger(Event& event) = 0;
         
         virtual bool InitWindowManagerCallbacks(const char* library) = 0;
@@ -59,6 +80,10 @@ namespace Coconuts
         virtual void SetVSync(bool enable) = 0;
         virtual bool IsVsyncEnabled() const = 0;
         
+        /* Adaptive falls back to On where the driver can't do it */
+        virtual void SetVSyncMode(VSyncMode mode) = 0;
+        virtual VSyncMode GetVSyncMode() const = 0;
+        
         static Window* Create(const WindowProperties& props = WindowProperties());
         
         virtual void* GetNativeWindow() const = 0;
@@ -19,6 +19,7 @@
 #include <coconuts/Logger.h>
 #include <coconuts/AssetManager.h>
 #include <coconuts/ecs/Serializer.h>
+#include "AssetPack.h"
 #include <fstream>
 #include <sstream>
 
@@ -39,31 +40,21 @@ namespace Coconuts
             return ConfigFileTypes::MetaBinary;
         }
         
+        else if (fileExt == Parser::FILE_EXTENSIONS::PACKED_ARCHIVE_FILE_EXT)
+        {
+            return ConfigFileTypes::PackedArchive;
+        }
+        
         return ConfigFileTypes::Unknown;
         
     }
     
-    static bool LoadMetaYAML(const std::string& filepath)
+    static bool LoadProject(std::string& yamlConf)
     {
-        std::ifstream file(filepath);
-        
-        if (!file.is_open() || file.fail())
-        {
-            LOG_CRITICAL("Failed to load configuration!");
-            LOG_CRITICAL("{} does not exist or failed to open", filepath);
-            file.close();
-            return false;
-        }
-        
-        std::stringstream stream;
-        stream << file.rdbuf();
-        std::string yamlConf = stream.str();
-        
         /* (1) Import Assets */
         if (!AssetManager::Deserialize(yamlConf))
         {
             LOG_CRITICAL("Failed to import Assets from .ccnproj file!");
-            file.close();
             return false;
         }
         
@@ -72,12 +63,30 @@ namespace Coconuts
         if (!serializer.Deserialize(yamlConf))
         {
             LOG_CRITICAL("Failed to load Scenes from .ccnproj file!");
+            return false;
+        }
+        
+        return true;
+    }
+    
+    static bool LoadMetaYAML(const std::string& filepath)
+    {
+        std::ifstream file(filepath);
+        
+        if (!file.is_open() || file.fail())
+        {
+            LOG_CRITICAL("Failed to load configuration!");
+            LOG_CRITICAL("{} does not exist or failed to open", filepath);
             file.close();
             return false;
         }
         
+        std::stringstream stream;
+        stream << file.rdbuf();
+        std::string yamlConf = stream.str();
         file.close();
-        return true;
+        
+        return LoadProject(yamlConf);
     }
     
     static bool LoadMetaBinary(const std::string& filepath)
@@ -86,6 +95,32 @@ namespace Coconuts
         return false;
     }
     
+    static bool LoadPackedArchive(const std::string& filepath)
+    {
+        if (!AssetPack::Mount(filepath))
+        {
+            return false;
+        }
+        
+        bool valid;
+        std::string yamlConf;
+        std::tie(valid, yamlConf) = AssetPack::GetProject();
+        
+        if (!valid)
+        {
+            LOG_CRITICAL("{} has no serialized project!", filepath);
+            AssetPack::Unmount();
+            return false;
+        }
+        
+        /* Textures are uploaded straight from the mapped archive while loading */
+        bool retVal = LoadProject(yamlConf);
+        
+        /* Every cooked blob was copied to the GPU by now */
+        AssetPack::Unmount();
+        return retVal;
+    }
+    
     //static
     bool AppManager::LoadRuntimeConfig(const std::string& filepath)
     {   
@@ -105,6 +140,13 @@ namespace Coconuts
                 return LoadMetaBinary(filepath);
             }
                 
+            case ConfigFileTypes::PackedArchive:
+            {
+                SceneManager::GetInstance().ClearAll();
+                AssetManager::ClearAll();
+                return LoadPackedArchive(filepath);
+            }
+                
             default:
                 //TODO
                 break;
@@ -28,6 +28,7 @@ namespace Coconuts
         {
             constexpr auto YAML_PROJECT_FILE_EXT = "ccnproj";
             constexpr auto METABINARY_FILE_EXT = "meta";
+            constexpr auto PACKED_ARCHIVE_FILE_EXT = "ccnpak";
         }
     }
     } //namespace
@@ -36,7 +37,8 @@ namespace Coconuts
     {
         Unknown         = 0,
         MetaText        = 1,
-        MetaBinary      = 2
+        MetaBinary      = 2,
+        PackedArchive   = 3
     };
     
     class AppManager
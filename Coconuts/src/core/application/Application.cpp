@@ -19,12 +19,14 @@
 #include <coconuts/Renderer.h>
 #include <coconuts/graphics/Renderer2D.h>
 #include <coconuts/time/Timestep.h>
-#include <GLFW/glfw3.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/jobs/JobSystem.h>
 #include <coconuts/editor_gui/GUILayer.h>
 #include <coconuts/types.h>
 #include <coconuts/AssetManager.h>
 #include <coconuts/SceneManager.h>
 #include <coconuts/FileSystem.h>
+#include <coconuts/Polling.h>
 #include "AppManager.h"
 
 
@@ -46,6 +48,9 @@ namespace Coconuts
         s_Instance = this;
         p_Window = window;
         
+        /* Worker threads (one per spare hardware thread) */
+        JobSystem::Init();
+        
         /* Initialize abstracted Renderer */
         Renderer::Init();
         Renderer2D::Init();
@@ -69,14 +74,25 @@ namespace Coconuts
     
     Application::~Application()
     {
-
+        JobSystem::Shutdown();
     }
     
     void Application::Run()
     {
-        float time = (float) glfwGetTime(); //TODO: Make this a platform dependent func call
-        Timestep timestep = time - m_LastFrameTime;
+        int64_t time = Clock::NowNanoseconds();
+        
+        /* First frame: nothing elapsed yet */
+        if (m_LastFrameTime == 0)
+        {
+            m_LastFrameTime = time;
+        }
+        
+        float frameSeconds = (float) Clock::NanosecondsToSeconds(time - m_LastFrameTime);
         m_LastFrameTime = time;
+        
+        /* Input state for this frame: Polling queries read it from here on (a replay also sets the frame time) */
+        Polling::Capture(frameSeconds);
+        Timestep timestep = frameSeconds;
 
         for (std::shared_ptr<Layer> layer : m_LayerStack)
         {
@@ -160,17 +176,25 @@ namespace Coconuts
     //static
     void AppManagerProxy::LoadRuntimeConfig()
     {
+        std::string filepath_ccnpak = FileSystem::GetRuntimeConfDirPath();
         std::string filepath_ccnproj = FileSystem::GetRuntimeConfDirPath();
         std::string filepath_meta = FileSystem::GetRuntimeConfDirPath();
         std::string appName = Application::GetInstance().GetApplicationName();
         
+        filepath_ccnpak += appName + "." + Parser::FILE_EXTENSIONS::PACKED_ARCHIVE_FILE_EXT;
         filepath_meta += appName + "." + Parser::FILE_EXTENSIONS::METABINARY_FILE_EXT;
         filepath_ccnproj += appName + "." + Parser::FILE_EXTENSIONS::YAML_PROJECT_FILE_EXT;
         
         /**
-         * Try to load meta binary first.
-         * If it fails, try to load from yaml configuration file.
+         * Try to load packed archive first (single memory mapped file).
+         * Then meta binary.
+         * If both fail, try to load from yaml configuration file.
          */
+        if (AppManager::LoadRuntimeConfig(filepath_ccnpak))
+        {
+            return;
+        }
+        
         if (!AppManager::LoadRuntimeConfig(filepath_meta))
         {
             LOG_ERROR("Meta binary file failed to load!");
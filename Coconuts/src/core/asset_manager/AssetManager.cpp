@@ -18,6 +18,11 @@
 #include <coconuts/Logger.h>
 #include "LoadingRefs.h"
 #include "AssetSerializer.h"
+#include "AssetPack.h"
+#include <fstream>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
 
 namespace Coconuts
 {
@@ -30,6 +35,77 @@ namespace Coconuts
     std::vector<std::string> AssetManager::m_KeysList_Textures2D;
     std::vector<std::string> AssetManager::m_KeysList_Sprites;
     
+    /* Static Deduplication Tables Definitions */
+    std::unordered_map<std::string, std::weak_ptr<Texture2D>>   AssetManager::m_Dedup_Paths;
+    std::unordered_map<uint64_t, std::weak_ptr<Texture2D>>      AssetManager::m_Dedup_Hashes;
+    
+    
+    /* Absolute path with symlinks and '.'/'..' resolved (same file -> same string) */
+    static std::string CanonicalPath(const std::string& path)
+    {
+        char resolved[PATH_MAX];
+        
+        if (realpath(path.c_str(), resolved) == nullptr)
+        {
+            return path;
+        }
+        
+        return std::string(resolved);
+    }
+    
+    /* FNV-1a 64 bit */
+    static uint64_t HashBytes(const void* data, uint64_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        
+        for (uint64_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+        
+        return hash;
+    }
+    
+    static bool ReadFile(const std::string& path, std::vector<uint8_t>& bytes)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        
+        if (!file.is_open())
+        {
+            return false;
+        }
+        
+        std::streamoff size = file.tellg();
+        if (size < 0)
+        {
+            return false;
+        }
+        
+        bytes.resize((size_t) size);
+        file.seekg(0);
+        return (bool) file.read(reinterpret_cast<char*>(bytes.data()), size);
+    }
+    
+    /**
+     * Hashes only pick candidates: confirm a match byte by byte against
+     * what the already imported texture was hashed from (rare: duplicates only).
+     */
+    static bool IsSameContent(const std::string& importedPath, const void* data, uint64_t size)
+    {
+        bool packed;
+        AssetPack::TextureView cooked;
+        std::tie(packed, cooked) = AssetPack::GetTexture2D(importedPath);
+        
+        if (packed)
+        {
+            return cooked.size == size && std::memcmp(cooked.pixels, data, size) == 0;
+        }
+        
+        std::vector<uint8_t> bytes;
+        return ReadFile(importedPath, bytes) && bytes.size() == size && std::memcmp(bytes.data(), data, size) == 0;
+    }
+    
     
     
     //static (non mandatory)
@@ -88,22 +164,111 @@ namespace Coconuts
         LOG_TRACE("  m_HashTable_Textures2D.maxload = {}", m_HashTable_Textures2D.max_load_factor());
 #endif
         
-        /* Create Texture2D from image path */
-        Texture2D* rawPtr = Texture2D::Create(path);
-        if (rawPtr == nullptr)
+        std::shared_ptr<Texture2D> texture2D;
+        uint32_t assetID;
+        
+        bool packed;
+        AssetPack::TextureView cooked;
+        std::tie(packed, cooked) = AssetPack::GetTexture2D(path);
+        
+        /* (1) Same file already imported (under any logical name)? */
+        std::string canonicalPath = packed ? path : CanonicalPath(path);
+        auto byPath = m_Dedup_Paths.find(canonicalPath);
+        if (byPath != m_Dedup_Paths.end())
         {
-            LOG_ERROR("Failed to import Texture2D '{}' from file '{}'!", logicalName, path);
-            return false;   // Failed. Stop here.
+            texture2D = byPath->second.lock();
         }
-         
-        std::shared_ptr<Texture2D> texture2D;
-        texture2D.reset(rawPtr);
         
-        /* Store Asset Path and get a unique ID */
-        uint32_t assetID = LoadingRefs::StorePath(path);
+        /* (2) Same image content already imported from another file? */
+        bool hashed = false;
+        uint64_t contentHash = 0;
+        std::vector<uint8_t> encoded;   /* file bytes, read once: hashed, then decoded */
+        if (texture2D == nullptr)
+        {
+            const void* content = packed ? cooked.pixels : nullptr;
+            uint64_t contentSize = packed ? cooked.size : 0;
+            
+            if (!packed && ReadFile(path, encoded))
+            {
+                content = encoded.data();
+                contentSize = encoded.size();
+            }
+            
+            hashed = (content != nullptr);
+            contentHash = hashed ? HashBytes(content, contentSize) : 0;
+            
+            auto byHash = m_Dedup_Hashes.find(contentHash);
+            if (hashed && byHash != m_Dedup_Hashes.end())
+            {
+                std::shared_ptr<Texture2D> candidate = byHash->second.lock();
+                
+                if (candidate != nullptr && IsSameContent(LoadingRefs::GetPath(candidate->rawID), content, contentSize))
+                {
+                    texture2D = candidate;
+                    
+                    /* Next import of this file stops at (1) */
+                    m_Dedup_Paths[canonicalPath] = texture2D;
+                }
+                
+                /* A collision: keep the first texture indexed, import this one on its own */
+                else if (candidate != nullptr)
+                {
+                    LOG_WARN("Texture2D '{}' content hash collides with {}", logicalName, LoadingRefs::GetPath(candidate->rawID));
+                    hashed = false;
+                }
+            }
+        }
         
-        /* Update Texture's ID */
-        texture2D->rawID = assetID;
+        if (texture2D != nullptr)
+        {
+            /* Alias: share GPU texture and its asset path */
+            assetID = texture2D->rawID;
+            LOG_DEBUG("Texture2D '{}' aliases an already imported texture ( {} )", logicalName, LoadingRefs::GetPath(assetID));
+        }
+        
+        else
+        {
+            Texture2D* rawPtr = nullptr;
+            
+            /* Prefer cooked pixels from a mounted .ccnpak archive (zero-copy) */
+            if (packed)
+            {
+                rawPtr = Texture2D::Create(path, cooked.width, cooked.height, cooked.channels, cooked.pixels);
+            }
+            
+            /* Decode the bytes read for hashing */
+            else if (!encoded.empty())
+            {
+                rawPtr = Texture2D::Create(path, encoded.data(), encoded.size());
+            }
+            
+            /* Create Texture2D from image path */
+            else
+            {
+                rawPtr = Texture2D::Create(path);
+            }
+            
+            if (rawPtr == nullptr)
+            {
+                LOG_ERROR("Failed to import Texture2D '{}' from file '{}'!", logicalName, path);
+                return false;   // Failed. Stop here.
+            }
+            
+            texture2D.reset(rawPtr);
+            
+            /* Store Asset Path and get a unique ID */
+            assetID = LoadingRefs::StorePath(path);
+            
+            /* Update Texture's ID */
+            texture2D->rawID = assetID;
+            
+            /* Remember it for later imports */
+            m_Dedup_Paths[canonicalPath] = texture2D;
+            if (hashed)
+            {
+                m_Dedup_Hashes[contentHash] = texture2D;
+            }
+        }
         
         /* Store */
         IndexedTexture2D indexed =
@@ -235,6 +400,47 @@ namespace Coconuts
         return false;
     }
     
+    //static
+    std::vector<std::string> AssetManager::GetTexture2DAliases(const std::string& logicalName)
+    {
+        std::vector<std::string> aliases;
+        
+        auto found = m_HashTable_Textures2D.find(logicalName);
+        if (found == m_HashTable_Textures2D.end())
+        {
+            return aliases;
+        }
+        
+        for (auto& name : m_KeysList_Textures2D)
+        {
+            if (name != logicalName && m_HashTable_Textures2D[name].texturePtr == found->second.texturePtr)
+            {
+                aliases.emplace_back(name);
+            }
+        }
+        
+        return aliases;
+    }
+    
+    //static
+    AssetManager::Texture2DDedupStats AssetManager::GetTexture2DDedupStats()
+    {
+        Texture2DDedupStats stats;
+        std::unordered_map<Texture2D*, uint32_t> namesPerTexture;
+        
+        for (auto& entry : m_HashTable_Textures2D)
+        {
+            if (++namesPerTexture[entry.second.texturePtr.get()] > 1)
+            {
+                stats.aliasedNames++;
+                stats.savedBytes += entry.second.texturePtr->GetSizeBytes();
+            }
+        }
+        
+        stats.uniqueTextures = namesPerTexture.size();
+        return stats;
+    }
+    
     //private satic
     uint32_t AssetManager::ReferenceTexture2D(const std::string& texture2DName, const std::string& spriteName)
     {
@@ -454,6 +660,8 @@ namespace Coconuts
         m_HashTable_Sprites.clear();
         m_KeysList_Textures2D.clear();
         m_KeysList_Sprites.clear();
+        m_Dedup_Paths.clear();
+        m_Dedup_Hashes.clear();
         LoadingRefs::Clear();
         Init();
         LOG_DEBUG("Cleared AssetManager state by request");
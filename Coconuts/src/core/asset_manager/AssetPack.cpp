@@ -0,0 +1,200 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AssetPack.h"
+#include <coconuts/Logger.h>
+#include <cstring>
+
+/* POSIX (GNU and MacOS) */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Coconuts
+{
+
+    const uint8_t* AssetPack::s_Base = nullptr;
+    uint64_t AssetPack::s_Size = 0;
+    std::unordered_map<std::string, const PackFormat::PackEntry*> AssetPack::s_TOC;
+
+
+    /* [offset, offset + size) within size bytes, without overflowing */
+    static bool InBounds(uint64_t offset, uint64_t size, uint64_t total)
+    {
+        return offset <= total && size <= total - offset;
+    }
+
+    /* A cooked texture blob holds at least width * height * channels bytes */
+    static bool IsValidTexture(const PackFormat::PackEntry& entry)
+    {
+        if (entry.width == 0 || entry.height == 0 || entry.channels < 1 || entry.channels > 4)
+        {
+            return false;
+        }
+
+        return (uint64_t) entry.width * entry.height <= entry.size / entry.channels;
+    }
+
+
+    //static
+    bool AssetPack::Mount(const std::string& path)
+    {
+        if (IsMounted())
+        {
+            Unmount();
+        }
+
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            LOG_DEBUG("AssetPack - {} does not exist or failed to open", path);
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(PackFormat::PackHeader))
+        {
+            LOG_ERROR("AssetPack - {} is not a valid archive", path);
+            close(fd);
+            return false;
+        }
+
+        void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);  // mapping keeps its own reference
+
+        if (mapping == MAP_FAILED)
+        {
+            LOG_ERROR("AssetPack - Failed to map {}", path);
+            return false;
+        }
+
+        s_Base = static_cast<const uint8_t*>(mapping);
+        s_Size = st.st_size;
+
+        /* Validate header */
+        const PackFormat::PackHeader* header = reinterpret_cast<const PackFormat::PackHeader*>(s_Base);
+        uint64_t tocSize = (uint64_t) header->entryCount * sizeof(PackFormat::PackEntry);
+
+        if ( memcmp(header->magic, PackFormat::MAGIC, sizeof(PackFormat::MAGIC)) != 0 ||
+             header->version != PackFormat::VERSION ||
+             !InBounds(header->tocOffset, tocSize, s_Size) || header->namesOffset > s_Size )
+        {
+            LOG_ERROR("AssetPack - {} has an invalid or unsupported header", path);
+            Unmount();
+            return false;
+        }
+
+        /* Index table of contents */
+        const PackFormat::PackEntry* entries = reinterpret_cast<const PackFormat::PackEntry*>(s_Base + header->tocOffset);
+        const char* names = reinterpret_cast<const char*>(s_Base + header->namesOffset);
+
+        s_TOC.reserve(header->entryCount);
+        for (uint32_t i = 0; i < header->entryCount; i++)
+        {
+            const PackFormat::PackEntry& entry = entries[i];
+
+            if ( !InBounds(entry.offset, entry.size, s_Size) ||
+                 !InBounds(header->namesOffset, (uint64_t) entry.nameOffset + entry.nameSize, s_Size) )
+            {
+                LOG_ERROR("AssetPack - {} entry {} is out of bounds", path, i);
+                Unmount();
+                return false;
+            }
+
+            /* Blobs go straight to the GPU: a short one would be read past its end */
+            if (entry.type == PackFormat::EntryType::Texture2D && !IsValidTexture(entry))
+            {
+                LOG_ERROR("AssetPack - {} entry {} is not a valid texture ({} x {} x {}, {} bytes)",
+                          path, i, entry.width, entry.height, entry.channels, entry.size);
+                Unmount();
+                return false;
+            }
+
+            s_TOC[std::string(names + entry.nameOffset, entry.nameSize)] = &entry;
+        }
+
+        LOG_DEBUG("AssetPack - Mounted {} ({} entries, {} bytes)", path, header->entryCount, s_Size);
+        return true;
+    }
+
+    //static
+    void AssetPack::Unmount()
+    {
+        if (s_Base != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(s_Base), s_Size);
+        }
+
+        s_Base = nullptr;
+        s_Size = 0;
+        s_TOC.clear();
+    }
+
+    //static
+    std::tuple<bool, std::string> AssetPack::GetProject()
+    {
+        const PackFormat::PackEntry* entry = Find(PackFormat::PROJECT_ENTRY_NAME, PackFormat::EntryType::Project);
+
+        if (entry == nullptr)
+        {
+            return std::make_tuple(false, std::string());
+        }
+
+        /* YAML parser needs its own copy of the text */
+        std::string project(reinterpret_cast<const char*>(s_Base + entry->offset), entry->size);
+        return std::make_tuple(true, project);
+    }
+
+    //static
+    std::tuple<bool, AssetPack::TextureView> AssetPack::GetTexture2D(const std::string& path)
+    {
+        TextureView view = {0, 0, 0, nullptr, 0};
+        const PackFormat::PackEntry* entry = Find(path, PackFormat::EntryType::Texture2D);
+
+        if (entry == nullptr)
+        {
+            return std::make_tuple(false, view);
+        }
+
+        view.width = entry->width;
+        view.height = entry->height;
+        view.channels = entry->channels;
+        view.pixels = s_Base + entry->offset;
+        view.size = entry->size;
+
+        return std::make_tuple(true, view);
+    }
+
+    //private static
+    const PackFormat::PackEntry* AssetPack::Find(const std::string& name, PackFormat::EntryType type)
+    {
+        if (!IsMounted())
+        {
+            return nullptr;
+        }
+
+        auto found = s_TOC.find(name);
+
+        if (found != s_TOC.end() && found->second->type == type)
+        {
+            return found->second;
+        }
+
+        return nullptr;
+    }
+
+}
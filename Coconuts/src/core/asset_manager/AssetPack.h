@@ -0,0 +1,65 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include "AssetPackFormat.h"
+
+namespace Coconuts
+{
+
+    /**
+     * Read-only view over a memory-mapped .ccnpak archive.
+     * Blobs are handed out as pointers into the mapping (zero-copy),
+     * so they are only valid while the archive is mounted.
+     */
+    class AssetPack
+    {
+    public:
+        struct TextureView
+        {
+            uint32_t        width;
+            uint32_t        height;
+            uint32_t        channels;
+            const void*     pixels;
+            uint64_t        size;
+        };
+
+        static bool Mount(const std::string& path);
+        static void Unmount();
+        static bool IsMounted() { return s_Base != nullptr; }
+
+        /* Serialized project (YAML text) stored in the archive */
+        static std::tuple<bool, std::string> GetProject();
+
+        /* Cooked texture stored under the path it had in the .ccnproj */
+        static std::tuple<bool, TextureView> GetTexture2D(const std::string& path);
+
+    private:
+        static const PackFormat::PackEntry* Find(const std::string& name, PackFormat::EntryType type);
+
+    private:
+        static const uint8_t* s_Base;
+        static uint64_t s_Size;
+        static std::unordered_map<std::string, const PackFormat::PackEntry*> s_TOC;
+    };
+
+}
+
+#endif /* ASSETPACK_H */
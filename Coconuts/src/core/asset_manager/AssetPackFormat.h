@@ -0,0 +1,78 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ASSETPACKFORMAT_H
+#define ASSETPACKFORMAT_H
+
+#include <cstdint>
+
+/**
+ * On-disk layout of a .ccnpak archive (shared by ccncore and ccnpacker).
+ *
+ *   [ PackHeader ]
+ *   [ blob 0 ] [ pad ] [ blob 1 ] [ pad ] ...   (each blob BLOB_ALIGNMENT aligned)
+ *   [ PackEntry x entryCount ]                  (table of contents)
+ *   [ names string table ]                      (not null terminated)
+ *
+ * All fields are stored in host (little-endian) byte order.
+ */
+namespace Coconuts {
+namespace PackFormat
+{
+
+    constexpr char     MAGIC[8]         = {'C', 'C', 'N', 'P', 'A', 'K', '\0', '\0'};
+    constexpr uint32_t VERSION          = 1;
+    constexpr uint64_t BLOB_ALIGNMENT   = 64;
+
+    /* TOC name of the serialized project entry */
+    constexpr auto PROJECT_ENTRY_NAME   = "project.ccnproj";
+
+    enum class EntryType : uint32_t
+    {
+        Unknown         = 0,
+        Project         = 1,    /* serialized .ccnproj (YAML text) */
+        Texture2D       = 2     /* cooked texture (decoded, vertically flipped RGBA8 pixels) */
+    };
+
+    struct PackHeader
+    {
+        char        magic[8];
+        uint32_t    version;
+        uint32_t    entryCount;
+        uint64_t    tocOffset;      /* absolute offset of first PackEntry */
+        uint64_t    namesOffset;    /* absolute offset of names string table */
+    };
+
+    struct PackEntry
+    {
+        EntryType   type;
+        uint32_t    nameOffset;     /* relative to names string table */
+        uint32_t    nameSize;
+        uint32_t    width;          /* Texture2D only */
+        uint32_t    height;         /* Texture2D only */
+        uint32_t    channels;       /* Texture2D only */
+        uint64_t    offset;         /* absolute offset of blob */
+        uint64_t    size;           /* blob size in bytes */
+    };
+
+    inline uint64_t AlignUp(uint64_t value)
+    {
+        return (value + BLOB_ALIGNMENT - 1) & ~(BLOB_ALIGNMENT - 1);
+    }
+
+}
+}
+
+#endif /* ASSETPACKFORMAT_H */
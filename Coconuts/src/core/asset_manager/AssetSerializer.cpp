@@ -16,6 +16,7 @@
 
 #include "AssetSerializer.h"
 #include "LoadingRefs.h"
+#include "AssetPack.h"
 #include <yaml-cpp/yaml.h>
 #include <coconuts/Logger.h>
 #include <coconuts/FileSystem.h>
@@ -178,7 +179,11 @@ namespace Coconuts
         std::string path = texture2d_node[KEY_STR_PATH].as<std::string>();
         
         /* Create abs path from a path relative to binary's location */
-        if (path.at(0) == '.')
+        /* (unless it is a cooked texture from a mounted .ccnpak, keyed by its original path) */
+        bool packed;
+        std::tie(packed, std::ignore) = AssetPack::GetTexture2D(path);
+        
+        if (!packed && path.at(0) == '.')
         {
             path = FileSystem::GetRuntimeBinDirPath() + path;
         }
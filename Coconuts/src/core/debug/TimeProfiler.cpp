@@ -20,6 +20,21 @@
 namespace Coconuts
 {
     
+    namespace
+    {
+        thread_local uint32_t t_ThreadIndex = 0;
+    }
+    
+    void Profiler::SetThreadIndex(uint32_t index)
+    {
+        t_ThreadIndex = index;
+    }
+    
+    uint32_t Profiler::GetThreadIndex()
+    {
+        return t_ThreadIndex;
+    }
+    
     //private
     Profiler::TimeProfiler::TimeProfiler()
     : m_Profiles(), m_Guard()
@@ -79,10 +94,31 @@ namespace Coconuts
         }
         
         // ELSE: Not found -> return dummy object
-        TimeData dummy = {"not found", "null", "null", 0, 0};
+        TimeData dummy = {"not found", "null", "null", 0, 0, 0};
         return std::vector<Profiler::TimeData> {dummy};
     }
     
+    std::vector<Profiler::TimeData> Profiler::TimeProfiler::Fetch(const std::string& key, uint32_t threadIndex)
+    {
+        std::lock_guard<std::mutex> lock(m_Guard);
+        std::vector<Profiler::TimeData> filtered;
+        
+        auto found = m_Profiles.find(key);
+        
+        if (found != m_Profiles.end())
+        {
+            for (const TimeData& data : found->second)
+            {
+                if (data.threadIndex == threadIndex)
+                {
+                    filtered.push_back(data);
+                }
+            }
+        }
+        
+        return filtered;
+    }
+    
     bool Profiler::TimeProfiler::Clear(const std::string& key)
     {
         std::lock_guard<std::mutex> lock(m_Guard);
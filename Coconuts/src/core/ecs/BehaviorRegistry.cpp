@@ -0,0 +1,198 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/BehaviorRegistry.h>
+#include <coconuts/ecs/components/BehaviorComponent.h>
+#include <coconuts/event_system/Event.h>
+#include <cmath>
+
+namespace Coconuts
+{
+    
+    std::atomic<uint32_t> BehaviorRegistry::s_NextTypeId {0};
+    
+    BehaviorRegistry::BehaviorRegistry(entityx::EventManager& events)
+    :   m_Pools(),
+        m_UpdatedPools(),
+        m_Factories(),
+        m_Time(0.0),
+        m_Timers(),
+        m_EventSleepers()
+    {
+        events.subscribe<entityx::ComponentRemovedEvent<BehaviorComponent>>(*this);
+    }
+    
+    void BehaviorRegistry::Remove(const BehaviorHandle& handle)
+    {
+        if (handle.type < m_Pools.size() && m_Pools[handle.type] != nullptr)
+        {
+            m_Pools[handle.type]->Remove(handle.slot, handle.generation);
+        }
+    }
+    
+    Behavior* BehaviorRegistry::Get(const BehaviorHandle& handle)
+    {
+        if (handle.type < m_Pools.size() && m_Pools[handle.type] != nullptr)
+        {
+            return m_Pools[handle.type]->Get(handle.slot, handle.generation);
+        }
+        
+        return nullptr;
+    }
+    
+    BehaviorHandle BehaviorRegistry::Recreate(const BehaviorRegistry& source, const BehaviorHandle& handle, Entity& affects)
+    {
+        if (handle.type >= source.m_Factories.size() || source.m_Factories[handle.type] == nullptr)
+        {
+            return BehaviorHandle();
+        }
+        
+        return source.m_Factories[handle.type](*this, affects);
+    }
+    
+    void BehaviorRegistry::UpdateAll(Timestep ts)
+    {
+        /* Naps that end within this step */
+        m_Time += ts.GetSeconds();
+        m_Timers.Advance((uint64_t) (m_Time / TICK_SECONDS), [this](const Sleeper& sleeper)
+        {
+            m_Pools[sleeper.handle.type]->Wake(sleeper.handle.slot, sleeper.handle.generation, sleeper.token);
+        });
+        
+        /* By index: a Behavior may create the first instance of another type */
+        for (size_t i = 0; i < m_UpdatedPools.size(); i++)
+        {
+            m_Pools[m_UpdatedPools[i]]->UpdateAll(ts);
+        }
+    }
+    
+    void BehaviorRegistry::OnEvent(Event& e)
+    {
+        uint32_t type = static_cast<uint32_t>(e.GetEventType());
+        if (type >= EVENT_TYPES || m_EventSleepers[type].empty())
+        {
+            return;
+        }
+        
+        /* Woken Behaviors may go back to sleep on the same event type */
+        std::vector<Sleeper> sleepers;
+        sleepers.swap(m_EventSleepers[type]);
+        
+        for (const Sleeper& sleeper : sleepers)
+        {
+            m_Pools[sleeper.handle.type]->Wake(sleeper.handle.slot, sleeper.handle.generation, sleeper.token);
+        }
+    }
+    
+    void BehaviorRegistry::Sleep(const BehaviorHandle& handle, float seconds)
+    {
+        if (handle.type >= m_Pools.size() || m_Pools[handle.type] == nullptr)
+        {
+            return;
+        }
+        
+        uint32_t token = m_Pools[handle.type]->Sleep(handle.slot, handle.generation);
+        if (token == 0 || seconds < 0.0f)
+        {
+            return;
+        }
+        
+        uint64_t due = (uint64_t) std::ceil((m_Time + seconds) / TICK_SECONDS);
+        m_Timers.Schedule(due, { handle, token });
+    }
+    
+    void BehaviorRegistry::SleepUntil(const BehaviorHandle& handle, EventType type)
+    {
+        if (handle.type >= m_Pools.size() || m_Pools[handle.type] == nullptr)
+        {
+            return;
+        }
+        
+        uint32_t token = m_Pools[handle.type]->Sleep(handle.slot, handle.generation);
+        if (token != 0 && static_cast<uint32_t>(type) < EVENT_TYPES)
+        {
+            m_EventSleepers[static_cast<uint32_t>(type)].push_back({ handle, token });
+        }
+    }
+    
+    void BehaviorRegistry::Wake(const BehaviorHandle& handle)
+    {
+        if (handle.type < m_Pools.size() && m_Pools[handle.type] != nullptr)
+        {
+            m_Pools[handle.type]->Wake(handle.slot, handle.generation, 0);
+        }
+    }
+    
+    bool BehaviorRegistry::IsSleeping(const BehaviorHandle& handle) const
+    {
+        if (handle.type < m_Pools.size() && m_Pools[handle.type] != nullptr)
+        {
+            return m_Pools[handle.type]->IsSleeping(handle.slot, handle.generation);
+        }
+        
+        return false;
+    }
+    
+    size_t BehaviorRegistry::GetAwakeCount() const
+    {
+        size_t count = 0;
+        for (const std::unique_ptr<BaseBehaviorPool>& pool : m_Pools)
+        {
+            count += (pool != nullptr) ? pool->GetAwakeCount() : 0;
+        }
+        
+        return count;
+    }
+    
+    size_t BehaviorRegistry::GetBehaviorCount() const
+    {
+        size_t count = 0;
+        for (const std::unique_ptr<BaseBehaviorPool>& pool : m_Pools)
+        {
+            count += (pool != nullptr) ? pool->GetSize() : 0;
+        }
+        
+        return count;
+    }
+    
+    size_t BehaviorRegistry::GetPoolCount() const
+    {
+        size_t count = 0;
+        for (const std::unique_ptr<BaseBehaviorPool>& pool : m_Pools)
+        {
+            count += (pool != nullptr) ? 1 : 0;
+        }
+        
+        return count;
+    }
+    
+    void BehaviorRegistry::receive(const entityx::ComponentRemovedEvent<BehaviorComponent>& event)
+    {
+        /* Entity destroyed or BehaviorComponent removed: its Behaviors go too */
+        const BehaviorComponent& component = *event.component;
+        
+        if (component.registry != this)
+        {
+            return;
+        }
+        
+        for (uint32_t i = 0; i < component.count; i++)
+        {
+            Remove(component.behaviors[i]);
+        }
+    }
+    
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/ChangeTracker.h>
+
+namespace Coconuts
+{
+    
+    std::atomic<uint64_t> ChangeTracker::s_Clock(0);
+    
+    ChangeTracker::ChangeTracker()
+        : m_Version(0), m_StructureVersion(0)
+    {
+        
+    }
+    
+    void ChangeTracker::MarkStructureChanged()
+    {
+        m_Version = ++s_Clock;
+        m_StructureVersion = m_Version;
+    }
+    
+    void ChangeTracker::MarkChanged(size_t family, entityx::Entity::Id id)
+    {
+        TypeChanges& type = m_Types[family];
+        m_Version = ++s_Clock;
+        type.version = m_Version;
+        
+        /* Nobody asks for this type's change set */
+        if (type.consumerCount == 0)
+        {
+            return;
+        }
+        
+        uint32_t index = id.index();
+        if (index >= type.slots.size())
+        {
+            type.slots.resize(index + 1);
+        }
+        
+        Slot& slot = type.slots[index];
+        slot.version = m_Version;
+        slot.id = id;
+        
+        if (slot.dirtyPos == NONE)
+        {
+            slot.dirtyPos = (uint32_t) type.dirty.size();
+            type.dirty.push_back(index);
+        }
+    }
+    
+    uint32_t ChangeTracker::AddConsumer(size_t family)
+    {
+        TypeChanges& type = m_Types[family];
+        type.consumerCount++;
+        
+        /* Changes made before registering are not reported */
+        uint64_t now = s_Clock.load();
+        
+        for (uint32_t i = 0; i < type.consumers.size(); i++)
+        {
+            if (type.consumers[i] == FREE_CONSUMER)
+            {
+                type.consumers[i] = now;
+                return i;
+            }
+        }
+        
+        type.consumers.push_back(now);
+        return (uint32_t) type.consumers.size() - 1;
+    }
+    
+    void ChangeTracker::RemoveConsumer(size_t family, uint32_t consumer)
+    {
+        TypeChanges& type = m_Types[family];
+        if (consumer >= type.consumers.size() || type.consumers[consumer] == FREE_CONSUMER)
+        {
+            return;
+        }
+        
+        type.consumers[consumer] = FREE_CONSUMER;
+        type.consumerCount--;
+        Trim(type);
+    }
+    
+    bool ChangeTracker::CollectChanges(size_t family, uint32_t consumer, std::vector<entityx::Entity::Id>& changed)
+    {
+        TypeChanges& type = m_Types[family];
+        if (consumer >= type.consumers.size() || type.consumers[consumer] == FREE_CONSUMER)
+        {
+            return false;
+        }
+        
+        uint64_t since = type.consumers[consumer];
+        size_t before = changed.size();
+        
+        for (uint32_t index : type.dirty)
+        {
+            const Slot& slot = type.slots[index];
+            if (slot.version > since)
+            {
+                changed.push_back(slot.id);
+            }
+        }
+        
+        type.consumers[consumer] = s_Clock.load();
+        Trim(type);
+        
+        return changed.size() > before;
+    }
+    
+    void ChangeTracker::Trim(TypeChanges& type)
+    {
+        /* Forget entities every consumer has already collected */
+        uint64_t oldest = FREE_CONSUMER;
+        for (uint64_t seen : type.consumers)
+        {
+            oldest = (seen < oldest) ? seen : oldest;
+        }
+        
+        uint32_t i = 0;
+        while (i < type.dirty.size())
+        {
+            Slot& slot = type.slots[type.dirty[i]];
+            if (slot.version > oldest)
+            {
+                i++;
+                continue;
+            }
+            
+            slot.dirtyPos = NONE;
+            uint32_t last = type.dirty.back();
+            type.dirty.pop_back();
+            
+            if (i < type.dirty.size())
+            {
+                type.dirty[i] = last;
+                type.slots[last].dirtyPos = i;
+            }
+        }
+    }
+    
+}
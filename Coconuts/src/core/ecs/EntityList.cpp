@@ -0,0 +1,95 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/EntityList.h>
+#include <coconuts/ecs/components/TagComponent.h>
+
+namespace Coconuts
+{
+    
+    EntityList::EntityList(entityx::EventManager& events)
+        : m_Holes(0)
+    {
+        events.subscribe<entityx::ComponentAddedEvent<TagComponent>>(*this);
+        events.subscribe<entityx::EntityDestroyedEvent>(*this);
+    }
+    
+    void EntityList::receive(const entityx::ComponentAddedEvent<TagComponent>& event)
+    {
+        uint32_t index = event.entity.id().index();
+        if (index >= m_Position.size())
+        {
+            m_Position.resize(index + 1, (uint32_t) NONE);
+        }
+        
+        /* Tag replaced: already listed */
+        if (m_Position[index] != NONE)
+        {
+            return;
+        }
+        
+        m_Position[index] = (uint32_t) m_Entries.size();
+        m_Entries.push_back(event.entity.id());
+    }
+    
+    void EntityList::receive(const entityx::EntityDestroyedEvent& event)
+    {
+        uint32_t index = event.entity.id().index();
+        if (index >= m_Position.size() || m_Position[index] == NONE)
+        {
+            return;
+        }
+        
+        m_Entries[m_Position[index]] = entityx::Entity::INVALID;
+        m_Position[index] = NONE;
+        m_Holes++;
+    }
+    
+    void EntityList::Reserve(size_t entries, size_t indices)
+    {
+        m_Entries.reserve(m_Entries.size() + entries);
+        if (indices > m_Position.size())
+        {
+            m_Position.resize(indices, (uint32_t) NONE);
+        }
+    }
+    
+    void EntityList::Compact()
+    {
+        if (m_Holes == 0)
+        {
+            return;
+        }
+        
+        size_t live = 0;
+        for (size_t i = 0; i < m_Entries.size(); i++)
+        {
+            entityx::Entity::Id id = m_Entries[i];
+            if (id == entityx::Entity::INVALID)
+            {
+                continue;
+            }
+            
+            m_Entries[live] = id;
+            m_Position[id.index()] = (uint32_t) live;
+            live++;
+        }
+        
+        m_Entries.resize(live);
+        m_Holes = 0;
+    }
+    
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/EventSubscriptionIndex.h>
+#include <coconuts/ecs/components/EventHandlerComponent.h>
+
+namespace Coconuts
+{
+    
+    EventSubscriptionIndex::EventSubscriptionIndex(entityx::EventManager& events)
+        : m_Version(0), m_Stale(true)
+    {
+        events.subscribe<entityx::ComponentRemovedEvent<EventHandlerComponent>>(*this);
+    }
+    
+    void EventSubscriptionIndex::receive(const entityx::ComponentRemovedEvent<EventHandlerComponent>& event)
+    {
+        m_Stale = true;
+    }
+    
+    void EventSubscriptionIndex::Refresh(CachedView<EventHandlerComponent>& handlers, uint64_t version)
+    {
+        if (!m_Stale && version == m_Version)
+        {
+            return;
+        }
+        
+        for (uint32_t type = 0; type < EVENT_TYPE_COUNT; type++)
+        {
+            m_Subscribers[type].clear();
+        }
+        
+        handlers.Each([this](entityx::Entity thisEntityxEntity, EventHandlerComponent& thisEventHandlerComponent)
+        {
+            for (uint32_t type = 0; type < EVENT_TYPE_COUNT; type++)
+            {
+                if (thisEventHandlerComponent.subscriptions & EventMaskOf(static_cast<EventType>(type)))
+                {
+                    m_Subscribers[type].push_back({ thisEntityxEntity, &thisEventHandlerComponent });
+                }
+            }
+        });
+        
+        m_Version = version;
+        m_Stale = false;
+    }
+    
+    void EventSubscriptionIndex::Dispatch(Event& e)
+    {
+        uint32_t type = static_cast<uint32_t>(e.GetEventType());
+        if (type >= EVENT_TYPE_COUNT)
+        {
+            return;
+        }
+        
+        /* By index: the list is only rebuilt on the next Refresh() */
+        const std::vector<Subscriber>& subscribers = m_Subscribers[type];
+        for (size_t i = 0; i < subscribers.size(); i++)
+        {
+            EventHandlerComponent* component = subscribers[i].component;
+            
+            /* A handler removed meanwhile: its slot may be gone or reused */
+            if (m_Stale)
+            {
+                entityx::Entity entity = subscribers[i].entity;
+                if (!entity.valid() || !entity.has_component<EventHandlerComponent>())
+                {
+                    continue;
+                }
+                
+                component = entity.component<EventHandlerComponent>().get();
+            }
+            
+            /* Prevent against non-initialized Event Handler Component */
+            if (component->instance == nullptr)
+            {
+                continue;
+            }
+            
+            component->OnEventFunc(component->instance, e);
+        }
+    }
+    
+    size_t EventSubscriptionIndex::GetSubscriberCount(EventType type) const
+    {
+        uint32_t index = static_cast<uint32_t>(type);
+        return (index < EVENT_TYPE_COUNT) ? m_Subscribers[index].size() : 0;
+    }
+    
+}
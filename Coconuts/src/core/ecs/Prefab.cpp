@@ -0,0 +1,131 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/Prefab.h>
+#include <coconuts/ecs/Entity.h>
+#include <coconuts/Logger.h>
+#include <map>
+
+namespace Coconuts
+{
+    
+    namespace
+    {
+        /* Ordered: the editor lists Prefabs by name */
+        std::map<std::string, Prefab>& GetPrefabs()
+        {
+            static std::map<std::string, Prefab> s_Prefabs;
+            return s_Prefabs;
+        }
+    }
+    
+    //static
+    Prefab Prefab::FromEntity(const std::string& prefabName, const Entity& entity)
+    {
+        Prefab prefab(prefabName);
+        
+        if (entity.HasComponent<TagComponent>())
+        {
+            prefab.tag = entity.ReadComponent<TagComponent>();
+        }
+        
+        if (entity.HasComponent<TransformComponent>())
+        {
+            prefab.hasTransform = true;
+            prefab.transform = entity.ReadComponent<TransformComponent>();
+            prefab.transform.StorePrevious();
+        }
+        
+        if (entity.HasComponent<SpriteComponent>())
+        {
+            prefab.hasSprite = true;
+            prefab.sprite = entity.ReadComponent<SpriteComponent>();
+        }
+        
+        if (entity.HasComponent<SpriteAnimationComponent>())
+        {
+            prefab.hasAnimation = true;
+            prefab.animation = entity.ReadComponent<SpriteAnimationComponent>();
+        }
+        
+        return prefab;
+    }
+    
+    //static
+    void PrefabLibrary::Add(const Prefab& prefab)
+    {
+        auto& prefabs = GetPrefabs();
+        
+        auto found = prefabs.find(prefab.name);
+        if (found != prefabs.end())
+        {
+            LOG_DEBUG("PrefabLibrary - Replacing Prefab {}", prefab.name);
+            found->second = prefab;
+            return;
+        }
+        
+        prefabs.emplace(prefab.name, prefab);
+        LOG_DEBUG("PrefabLibrary - Added Prefab {}", prefab.name);
+    }
+    
+    //static
+    bool PrefabLibrary::Remove(const std::string& name)
+    {
+        if (GetPrefabs().erase(name) == 0)
+        {
+            LOG_WARN("PrefabLibrary - No Prefab named {}", name);
+            return false;
+        }
+        
+        return true;
+    }
+    
+    //static
+    void PrefabLibrary::Clear()
+    {
+        GetPrefabs().clear();
+    }
+    
+    //static
+    const Prefab* PrefabLibrary::Get(const std::string& name)
+    {
+        auto& prefabs = GetPrefabs();
+        
+        auto found = prefabs.find(name);
+        return (found != prefabs.end()) ? &found->second : nullptr;
+    }
+    
+    //static
+    std::vector<std::string> PrefabLibrary::GetAllNames()
+    {
+        std::vector<std::string> names;
+        names.reserve(GetPrefabs().size());
+        
+        for (auto& entry : GetPrefabs())
+        {
+            names.push_back(entry.first);
+        }
+        
+        return names;
+    }
+    
+    //static
+    size_t PrefabLibrary::GetSize()
+    {
+        return GetPrefabs().size();
+    }
+    
+}
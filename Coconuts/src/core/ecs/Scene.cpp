@@ -16,21 +16,30 @@
 
 #include <coconuts/ecs/Scene.h>
 #include <coconuts/ecs/Entity.h>
+#include <coconuts/ecs/Prefab.h>
 #include <coconuts/Renderer.h>
 #include <coconuts/Logger.h>
 #include <coconuts/graphics/defs.h>
 #include <coconuts/debug/Profiler.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Polling.h>
+#include <cmath>
 
 // Components
 #include <coconuts/ecs/components/TagComponent.h>
 #include <coconuts/ecs/components/TransformComponent.h>
 #include <coconuts/ecs/components/SpriteComponent.h>
+#include <coconuts/ecs/components/SpriteAnimationComponent.h>
+#include <coconuts/ecs/components/TilemapComponent.h>
+#include <coconuts/ecs/components/ParticleEmitterComponent.h>
 #include <coconuts/ecs/components/OrthoCameraComponent.h>
 #include <coconuts/ecs/components/BehaviorComponent.h>
 #include <coconuts/ecs/components/EventHandlerComponent.h>
 
 // Default Systems
 #include <coconuts/ecs/systems/CameraNavSystem.h>
+#include <coconuts/ecs/systems/SpriteAnimationSystem.h>
+#include <coconuts/ecs/systems/ParticleSystem.h>
 
 // Default Event Handlers
 #include <coconuts/ecs/event_handlers/CameraEventHandler.h>
@@ -38,6 +47,59 @@
 namespace Coconuts
 {
     
+    namespace
+    {
+        /**
+         * Component copies for Scene::Clone(). Plain data is copy constructed;
+         * resources changed at run time (tiles, particles) get their own instance
+         * so playing a clone leaves the original untouched.
+         */
+        template <typename C>
+        C CopyOf(const C& component)
+        {
+            return component;
+        }
+        
+        TilemapComponent CopyOf(const TilemapComponent& component)
+        {
+            TilemapComponent copy(component);
+            
+            if (component.tilemap != nullptr)
+            {
+                const Tilemap& tilemap = *component.tilemap;
+                copy.tilemap = std::make_shared<Tilemap>(tilemap.GetWidth(), tilemap.GetHeight(), tilemap.GetTileSize());
+                copy.tilemap->SetTileset(tilemap.GetTileset(), tilemap.GetCellSize());
+                copy.tilemap->SetTintColor(tilemap.GetTintColor());
+                copy.tilemap->SetTiles(tilemap.GetTiles());
+            }
+            
+            return copy;
+        }
+        
+        ParticleEmitterComponent CopyOf(const ParticleEmitterComponent& component)
+        {
+            ParticleEmitterComponent copy(component);
+            
+            /* Particles in flight are not copied */
+            if (component.pool != nullptr)
+            {
+                copy.pool = std::make_shared<ParticlePool>(component.pool->GetCapacity());
+            }
+            
+            return copy;
+        }
+        
+        template <typename C>
+        void CloneComponent(entityx::Entity source, entityx::Entity target, ChangeTracker& changes)
+        {
+            if (source.has_component<C>())
+            {
+                target.assign<C>(CopyOf(*source.component<const C>().get()));
+                changes.MarkChanged<C>(target);
+            }
+        }
+    }
+    
     void Scene::OnUpdate(Timestep ts)
     {
         __CCNCORE_PROFILER_SCOPE__ ("Scene:OnUpdate")
@@ -47,43 +109,133 @@ namespace Coconuts
             return;
         }
         
+        /* Variable step: simulate once per rendered frame */
+        if (m_FixedTimestep <= 0.0f)
+        {
+            Simulate(ts);
+            Render(1.0f);
+            return;
+        }
         
-        /* Systems */
-        /* ---------------------------------------------------------------------- */
+        /**
+         * Fixed step: consume frame time in m_FixedTimestep slices.
+         * Simulation is capped at m_MaxCatchUpSteps per frame, so a long
+         * hitch (debugger, window drag) doesn't spiral into ever longer frames.
+         */
+        m_Accumulator += ts.GetSeconds();
         
-        /* Update Behavior scripts */
+        uint32_t steps = 0;
+        while (m_Accumulator >= m_FixedTimestep && steps < m_MaxCatchUpSteps)
         {
-            __CCNCORE_PROFILER_SCOPE__ ("Scene:ExecuteBehaviors")
-            
-            m_EntityManager.entities.each<BehaviorComponent>([&]
-            (entityx::Entity thisEntityxEntity, BehaviorComponent& thisBehaviorComponent)
+            m_Transforms.ParallelEach([]
+            (entityx::Entity thisEntityxEntity, TransformComponent& thisTransformComponent)
             {
-                /* Prevent against non-initialized Behavior Component */
-                if (thisBehaviorComponent.instance == nullptr)
-                {
-                    return;
-                }
-                
-                thisBehaviorComponent.OnUpdateFunc(thisBehaviorComponent.instance, ts);
-            });
+                thisTransformComponent.StorePrevious();
+            }, 0, "Scene:StorePrevious");
+            
+            Simulate(m_FixedTimestep);
+            m_Accumulator -= m_FixedTimestep;
+            steps++;
+            
+            /* Input edges are seen by one step only */
+            Polling::ConsumeEdges();
+        }
+        
+        /* No step this frame: the next one sees this frame's edges */
+        if (steps == 0)
+        {
+            Polling::HoldEdges();
         }
         
+        /* Still behind: drop the backlog (simulation runs slower than real time) */
+        if (m_Accumulator >= m_FixedTimestep)
+        {
+            LOG_TRACE("Scene {} - Dropping {} ms of simulation", m_Name, (float) (m_Accumulator * 1000.0));
+            m_Accumulator = std::fmod(m_Accumulator, (double) m_FixedTimestep);
+        }
+        
+        Render((float) (m_Accumulator / m_FixedTimestep));
+    }
+    
+    void Scene::SetSimulationRate(float hz)
+    {
+        m_FixedTimestep = (hz > 0.0f) ? (1.0f / hz) : 0.0f;
+        m_Accumulator = 0.0;
+    }
+    
+    void Scene::SetMaxCatchUpSteps(uint32_t steps)
+    {
+        m_MaxCatchUpSteps = (steps > 0) ? steps : 1;
+    }
+    
+    void Scene::Simulate(Timestep ts)
+    {
+        __CCNCORE_PROFILER_SCOPE__ ("Scene:Systems")
+        
+        m_Systems.Run(m_EntityManager.entities, ts);
+    }
+    
+    void Scene::RegisterSystem(const std::string& name, const SystemAccess& access, const SystemFunction& function)
+    {
+        m_Systems.Register(name, access, function);
+    }
+    
+    bool Scene::UnregisterSystem(const std::string& name)
+    {
+        return m_Systems.Unregister(name);
+    }
+    
+    void Scene::RegisterDefaultSystems()
+    {
+        /* Behavior scripts may touch anything (and poll input): alone, on the main thread */
+        m_Systems.Register("Scene:ExecuteBehaviors", SystemAccess().Exclusive().MainThread(), [this]
+        (entityx::EntityManager& entities, Timestep ts)
+        {
+            m_Behaviors.UpdateAll(ts);
+        });
+        
+        /* Advance Sprite animations */
+        m_Systems.Register("Scene:SpriteAnimations",
+                           SystemAccess().Write<SpriteAnimationComponent>(),
+                           &SpriteAnimationSystem::OnUpdate);
         
+        /* Simulate Particles */
+        m_Systems.Register("Scene:Particles",
+                           SystemAccess().Read<TransformComponent>().Write<ParticleEmitterComponent>(),
+                           &ParticleSystem::OnUpdate);
+    }
+    
+    void Scene::Render(float alpha)
+    {
         /* Rendering */
         /* ---------------------------------------------------------------------- */
         
         /* Reset all Rendering statistics for next draw call */
         Renderer2D::ResetStatistics();
         
+        /* World matrices of moved / reparented Transforms (and their children) */
+        {
+            __CCNCORE_PROFILER_SCOPE__ ("Scene:TransformHierarchy")
+            m_Hierarchy.Update();
+        }
+        
         /**
          * NOTE:    We're looping through all entities that have a OrthoCameraComponent,
          *          but there should be only 1 Camera per Scene!!!     
          *
          */
-        m_EntityManager.entities.each<OrthoCameraComponent>([&](entityx::Entity thisEntityxEntity, OrthoCameraComponent& thisOrthoCameraComponent)
+        m_Cameras.Each([&](entityx::Entity thisEntityxEntity, OrthoCameraComponent& thisOrthoCameraComponent)
         {
             __CCNCORE_PROFILER_SCOPE__ ("Scene:Renderer2D")
             
+            /* Camera follows its interpolated world Transform too */
+            if (thisEntityxEntity.has_component<TransformComponent>())
+            {
+                glm::mat4 world = m_Hierarchy.GetInterpolatedWorldMatrix(thisEntityxEntity, alpha);
+                float rotation = -std::atan2(world[0][1], world[0][0]);
+                thisOrthoCameraComponent.camera.SetTransform({world[3][0], world[3][1], 0.0f}, rotation);
+            }
+            
             /* Clear Screen */
             Graphics::LowLevelAPI::SetClearColor(thisOrthoCameraComponent.backgroundColor);
             Graphics::LowLevelAPI::Clear();
@@ -91,17 +243,40 @@ namespace Coconuts
             /* Begin Scene */
             Renderer2D::BeginScene(thisOrthoCameraComponent.camera);
             
+            /* Draw visible chunks of all Tilemaps first (background) */
+            const glm::mat4& viewProj = thisOrthoCameraComponent.camera.GetViewProjMatrix();
+            m_Tilemaps.Each([this, &viewProj]
+            (entityx::Entity thisEntityxEntity, TransformComponent& thisTransformComponent, TilemapComponent& thisTilemapComponent)
+            {
+                if (thisTilemapComponent.tilemap == nullptr)
+                {
+                    return;
+                }
+                
+                /* Tilemaps are not rotated / scaled: only the world position is used */
+                const glm::mat4& world = m_Hierarchy.GetWorldMatrix(thisEntityxEntity);
+                thisTilemapComponent.tilemap->Draw({world[3][0], world[3][1]}, viewProj, thisTilemapComponent.sampler);
+            });
+            
             /* Draw All Sprites on this Scene */
-            m_EntityManager.entities.each<TransformComponent, SpriteComponent>([]
+            m_Sprites.Each([this, alpha]
             (entityx::Entity thisEntityxEntity, TransformComponent& thisTransformComponent, SpriteComponent& thisSpriteComponent)
             {
+                /* Animated Entities are drawn below */
+                if (thisEntityxEntity.has_component<SpriteAnimationComponent>())
+                {
+                    return;
+                }
+                
+                glm::mat4 world = m_Hierarchy.GetInterpolatedWorldMatrix(thisEntityxEntity, alpha);
+                
                 /**
                  * Protect against non-initialized Sprite.
                  * Draw a default texture.
                  */
                 if (thisSpriteComponent.sprite.expired())
                 {
-                    Renderer2D::DrawRotatedQuad(thisTransformComponent.position,        // Entity's position
+                    Renderer2D::DrawRotatedQuad(glm::vec2(world[3][0], world[3][1]),      // Entity's position
                                                 glm::vec2(1.0f),                        // default size
                                                 0.0f,                                   // default rotation
                                                 defs::DefaultMissingSpriteTexturePtr(), // default texture
@@ -112,14 +287,34 @@ namespace Coconuts
                     return;
                 }
                 
-                Renderer2D::DrawRotatedQuad(thisTransformComponent.position,
-                                            thisTransformComponent.size,
-                                            thisTransformComponent.rotationRadians,
-                                            thisSpriteComponent.sprite.lock(),
-                                            thisSpriteComponent.tilingFactor,
-                                            thisSpriteComponent.tintColor);
+                Renderer2D::DrawQuad(world,
+                                     thisSpriteComponent.sprite.lock(),
+                                     thisSpriteComponent.tilingFactor,
+                                     thisSpriteComponent.tintColor,
+                                     thisSpriteComponent.sampler);
+            });
+            
+            /* Draw All animated Sprites on this Scene */
+            m_AnimatedSprites.Each([this, alpha]
+            (entityx::Entity thisEntityxEntity, TransformComponent& thisTransformComponent, SpriteAnimationComponent& thisAnimationComponent)
+            {
+                if (thisAnimationComponent.clip == nullptr)
+                {
+                    return;
+                }
+                
+                const SpriteAnimationClip& clip = *thisAnimationComponent.clip;
+                Renderer2D::DrawQuad(m_Hierarchy.GetInterpolatedWorldMatrix(thisEntityxEntity, alpha),
+                                     clip.GetTexture(),
+                                     clip.GetTextureCoords(thisAnimationComponent.frame),
+                                     thisAnimationComponent.tilingFactor,
+                                     thisAnimationComponent.tintColor,
+                                     thisAnimationComponent.sampler);
             });
             
+            /* Particles on top */
+            ParticleSystem::OnRender(m_EntityManager.entities);
+            
             /* End Scene */
             Renderer2D::EndScene();
         });
@@ -133,23 +328,18 @@ namespace Coconuts
             return;
         }
         
-        /* Dispatch Event to Event Handlers */
-        m_EntityManager.entities.each<EventHandlerComponent>([&](entityx::Entity thisEntityxEntity, EventHandlerComponent& thisEventHandlerComponent)
-        {
-            /* Prevent against non-initialized Event Handler Component */
-            if (thisEventHandlerComponent.instance == nullptr)
-            {
-                return;
-            }
-            
-            thisEventHandlerComponent.OnEventFunc(thisEventHandlerComponent.instance, e);
-        });
+        /* Wake Behaviors waiting for this event */
+        m_Behaviors.OnEvent(e);
+        
+        /* Dispatch Event to the Event Handlers subscribed to its type */
+        m_EventSubscriptions.Refresh(m_EventHandlers, m_Changes.GetVersion<EventHandlerComponent>());
+        m_EventSubscriptions.Dispatch(e);
     }
     
     void Scene::OnChangeViewport(float x, float y)
     {
         /* Change aspect ratio on Scene's camera */
-        m_EntityManager.entities.each<OrthoCameraComponent>([x, y](entityx::Entity thisEntityxEntity, OrthoCameraComponent& thisOrthoCameraComponent)
+        m_Cameras.Each([x, y](entityx::Entity thisEntityxEntity, OrthoCameraComponent& thisOrthoCameraComponent)
         {
             thisOrthoCameraComponent.aspectRatio = (float) (x / y);   
             // Cameras matrices are updated by its Camera Nav System!
@@ -159,6 +349,11 @@ namespace Coconuts
     }
     
     Scene::Scene(uint16_t id, const std::string& name, bool isActive)
+    :   Scene(id, name, isActive, true)
+    {
+    }
+    
+    Scene::Scene(uint16_t id, const std::string& name, bool isActive, bool defaultCamera)
     :   m_ID(id),
         m_Name(name),
         m_IsActive(isActive),
@@ -166,19 +361,162 @@ namespace Coconuts
         m_HaltEditorCameraNavigation(false),
         m_DefaultCameraID(0),
         m_IsUpdated(false),
-        m_AspectRatio(0.0f)
+        m_AspectRatio(0.0f),
+        m_EntityManager(),
+        m_Behaviors(m_EntityManager.events),
+        m_Changes(),
+        m_EntityList(m_EntityManager.events),
+        m_Hierarchy(m_EntityManager.events),
+        m_Transforms(m_EntityManager.entities, m_EntityManager.events),
+        m_Cameras(m_EntityManager.entities, m_EntityManager.events),
+        m_Tilemaps(m_EntityManager.entities, m_EntityManager.events),
+        m_Sprites(m_EntityManager.entities, m_EntityManager.events),
+        m_AnimatedSprites(m_EntityManager.entities, m_EntityManager.events),
+        m_EventHandlers(m_EntityManager.entities, m_EntityManager.events),
+        m_EventSubscriptions(m_EntityManager.events),
+        m_FixedTimestep(1.0f / 60.0f),
+        m_MaxCatchUpSteps(5),
+        m_Accumulator(0.0),
+        m_Systems()
     {
         LOG_INFO("Create New Scene ({}, {}, {})", m_Name, m_ID, m_IsActive ? "true" : "false");
-        CreateDefaultSceneCamera();
+        RegisterDefaultSystems();
+        
+        if (defaultCamera)
+        {
+            CreateDefaultSceneCamera();
+        }
     }
     
     Scene::~Scene()
     {
+        /* Event Handlers are allocated by their components: free them with the Scene */
+        m_EventHandlers.Each([](entityx::Entity thisEntityxEntity, EventHandlerComponent& thisEventHandlerComponent)
+        {
+            if (thisEventHandlerComponent.instance != nullptr && thisEventHandlerComponent.Destroy)
+            {
+                thisEventHandlerComponent.Destroy();
+            }
+        });
+        
         LOG_WARN("Scene destroyed by request ({}, {})", m_Name, m_ID);
     }
     
+    std::shared_ptr<Scene> Scene::Clone()
+    {
+        __CCNCORE_PROFILER_SCOPE__ ("Scene:Clone")
+        
+        int64_t start = Clock::NowNanoseconds();
+        
+        std::shared_ptr<Scene> clone(new Scene(m_ID, m_Name, m_IsActive, false));
+        clone->m_HaltAllEvents = m_HaltAllEvents;
+        clone->m_HaltEditorCameraNavigation = m_HaltEditorCameraNavigation;
+        clone->m_AspectRatio = m_AspectRatio;
+        clone->m_FixedTimestep = m_FixedTimestep;
+        clone->m_MaxCatchUpSteps = m_MaxCatchUpSteps;
+        clone->m_Systems.Merge(m_Systems);
+        clone->Reserve(m_EntityManager.entities.size());
+        
+        entityx::EntityManager& targets = clone->m_EntityManager.entities;
+        ChangeTracker& changes = clone->m_Changes;
+        
+        /* source index -> copy */
+        std::vector<entityx::Entity::Id> remap(m_EntityManager.entities.capacity(), entityx::Entity::INVALID);
+        std::vector<entityx::Entity> sources;
+        sources.reserve(m_EntityManager.entities.size());
+        
+        /* Plain data first: Behaviors created below may read any Component */
+        auto copyEntity = [&](entityx::Entity source)
+        {
+            entityx::Entity target = targets.create();
+            remap[source.id().index()] = target.id();
+            sources.push_back(source);
+            
+            CloneComponent<TagComponent>(source, target, changes);
+            CloneComponent<TransformComponent>(source, target, changes);
+            CloneComponent<OrthoCameraComponent>(source, target, changes);
+            CloneComponent<SpriteComponent>(source, target, changes);
+            CloneComponent<SpriteAnimationComponent>(source, target, changes);
+            CloneComponent<TilemapComponent>(source, target, changes);
+            CloneComponent<ParticleEmitterComponent>(source, target, changes);
+        };
+        
+        /* Tagged Entities in creation order (as listed in the editor), then the rest */
+        for (size_t i = 0; i < m_EntityList.GetSize(); i++)
+        {
+            entityx::Entity::Id id = m_EntityList.Get(i);
+            if (id != entityx::Entity::INVALID)
+            {
+                copyEntity(m_EntityManager.entities.get(id));
+            }
+        }
+        
+        for (entityx::Entity source : m_EntityManager.entities.entities_for_debugging())
+        {
+            if (remap[source.id().index()] == entityx::Entity::INVALID)
+            {
+                copyEntity(source);
+            }
+        }
+        
+        /* Behaviors and Event Handlers are bound to their Entity: new ones */
+        for (entityx::Entity source : sources)
+        {
+            Entity entity;
+            entity.m_EntityxEntity = targets.get(remap[source.id().index()]);
+            entity.m_Scene = clone.get();
+            
+            if (source.has_component<BehaviorComponent>())
+            {
+                const BehaviorComponent& behaviors = *source.component<const BehaviorComponent>().get();
+                entity.m_EntityxEntity.assign<BehaviorComponent>()->RecreateBehaviors(behaviors, entity);
+            }
+            
+            if (source.has_component<EventHandlerComponent>())
+            {
+                const EventHandlerComponent& handler = *source.component<const EventHandlerComponent>().get();
+                EventHandlerComponent& copy = *entity.m_EntityxEntity.assign<EventHandlerComponent>().get();
+                
+                if (handler.AddHandlerTo)
+                {
+                    handler.AddHandlerTo(copy, entity);
+                    copy.subscriptions = handler.subscriptions;
+                }
+                
+                clone->m_Changes.MarkChanged<EventHandlerComponent>(entity.m_EntityxEntity);
+            }
+        }
+        
+        /* Parent links */
+        m_Transforms.Each([&](entityx::Entity thisEntityxEntity, TransformComponent& thisTransformComponent)
+        {
+            entityx::Entity::Id parent = m_Hierarchy.GetParent(thisEntityxEntity);
+            if (parent != entityx::Entity::INVALID)
+            {
+                clone->m_Hierarchy.SetParent(targets.get(remap[thisEntityxEntity.id().index()]),
+                                             targets.get(remap[parent.index()]));
+            }
+        });
+        
+        entityx::Entity::Id camera(m_DefaultCameraID);
+        if (m_EntityManager.entities.valid(camera) && remap[camera.index()] != entityx::Entity::INVALID)
+        {
+            clone->m_DefaultCameraID = remap[camera.index()].id();
+        }
+        
+        changes.MarkStructureChanged();
+        clone->m_IsUpdated = true;
+        
+        LOG_DEBUG("Scene {} cloned: {} entities in {} ms", m_Name, sources.size(),
+                  (Clock::NowNanoseconds() - start) * 1.0e-6);
+        
+        return clone;
+    }
+    
     entityx::Entity Scene::CreateEntity()
     {
+        m_Changes.MarkStructureChanged();
+        m_IsUpdated = true;
         return m_EntityManager.entities.create();
     }
     
@@ -201,6 +539,24 @@ namespace Coconuts
         return all;
     }
         
+    Entity Scene::GetEntity(uint64_t id)
+    {
+        Entity entity;
+        entity.m_EntityxEntity = m_EntityManager.entities.get(entityx::Entity::Id(id));
+        entity.m_Scene = this;
+        return entity;
+    }
+    
+    bool Scene::SetParent(Entity& child, Entity& parent)
+    {
+        return m_Hierarchy.SetParent(child.m_EntityxEntity, parent.m_EntityxEntity);
+    }
+    
+    void Scene::ClearParent(Entity& child)
+    {
+        m_Hierarchy.ClearParent(child.m_EntityxEntity);
+    }
+    
     bool Scene::DestroyEntity(uint64_t id)
     {
         /* Create an Entityx ID based on raw id number */
@@ -208,10 +564,139 @@ namespace Coconuts
         
         /* Destroy Entity */
         m_EntityManager.entities.destroy(entityID);
+        m_Changes.MarkStructureChanged();
+        m_IsUpdated = true;
         
         return true;
     }
     
+    void Scene::Reserve(size_t entities)
+    {
+        /* Freed indices are reused first, so this may overshoot: fine for a reserve */
+        size_t indices = m_EntityManager.entities.capacity() + entities;
+        
+        m_EntityList.Reserve(entities, indices);
+        m_Hierarchy.Reserve(0, indices);
+        m_Transforms.Reserve(0, indices);
+        m_Cameras.Reserve(0, indices);
+        m_Tilemaps.Reserve(0, indices);
+        m_Sprites.Reserve(0, indices);
+        m_AnimatedSprites.Reserve(0, indices);
+        m_EventHandlers.Reserve(0, indices);
+    }
+    
+    uint32_t Scene::Instantiate(const Prefab& prefab, uint32_t count, std::vector<Entity>* created)
+    {
+        __CCNCORE_PROFILER_SCOPE__ ("Scene:Instantiate")
+        
+        if (count == 0)
+        {
+            return 0;
+        }
+        
+        Reserve(count);
+        
+        /* Only the views this Prefab lands in grow */
+        if (prefab.hasTransform)
+        {
+            m_Hierarchy.Reserve(count, 0);
+            m_Transforms.Reserve(count, 0);
+            
+            if (prefab.hasSprite && !prefab.hasAnimation)
+            {
+                m_Sprites.Reserve(count, 0);
+            }
+            
+            if (prefab.hasAnimation)
+            {
+                m_AnimatedSprites.Reserve(count, 0);
+            }
+        }
+        
+        if (created != nullptr)
+        {
+            created->reserve(created->size() + count);
+        }
+        
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entityx::Entity thisEntityxEntity = m_EntityManager.entities.create();
+            
+            thisEntityxEntity.assign<TagComponent>(prefab.tag);
+            m_Changes.MarkChanged<TagComponent>(thisEntityxEntity);
+            
+            if (prefab.hasTransform)
+            {
+                thisEntityxEntity.assign<TransformComponent>(prefab.transform);
+                m_Changes.MarkChanged<TransformComponent>(thisEntityxEntity);
+            }
+            
+            if (prefab.hasSprite)
+            {
+                thisEntityxEntity.assign<SpriteComponent>(prefab.sprite);
+                m_Changes.MarkChanged<SpriteComponent>(thisEntityxEntity);
+            }
+            
+            if (prefab.hasAnimation)
+            {
+                thisEntityxEntity.assign<SpriteAnimationComponent>(prefab.animation);
+                m_Changes.MarkChanged<SpriteAnimationComponent>(thisEntityxEntity);
+            }
+            
+            if (created != nullptr)
+            {
+                Entity entity;
+                entity.m_EntityxEntity = thisEntityxEntity;
+                entity.m_Scene = this;
+                created->push_back(entity);
+            }
+        }
+        
+        m_Changes.MarkStructureChanged();
+        m_IsUpdated = true;
+        
+        return count;
+    }
+    
+    uint32_t Scene::Instantiate(const std::string& prefabName, uint32_t count, std::vector<Entity>* created)
+    {
+        const Prefab* prefab = PrefabLibrary::Get(prefabName);
+        if (prefab == nullptr)
+        {
+            LOG_ERROR("Scene {} - Unknown Prefab {}", m_Name, prefabName);
+            return 0;
+        }
+        
+        return Instantiate(*prefab, count, created);
+    }
+    
+    uint32_t Scene::DestroyEntities(const std::vector<uint64_t>& ids)
+    {
+        __CCNCORE_PROFILER_SCOPE__ ("Scene:DestroyEntities")
+        
+        uint32_t destroyed = 0;
+        for (uint64_t id : ids)
+        {
+            /* Stale or repeated ids are skipped */
+            entityx::Entity::Id entityID(id);
+            if (!m_EntityManager.entities.valid(entityID))
+            {
+                continue;
+            }
+            
+            m_EntityManager.entities.destroy(entityID);
+            destroyed++;
+        }
+        
+        if (destroyed > 0)
+        {
+            m_Changes.MarkStructureChanged();
+            m_IsUpdated = true;
+        }
+        
+        return destroyed;
+    }
+    
     bool Scene::SetActiveFlag(bool flag)
     {
         m_IsActive = flag;
@@ -127,6 +127,21 @@ namespace Coconuts
         return true;
     }
     
+    std::shared_ptr<Scene> SceneManager::ReplaceScene(uint16_t id, const std::shared_ptr<Scene>& scene)
+    {
+        if (m_ScenesBuffer.size() <= id || !scene)
+        {
+            return nullptr;
+        }
+        
+        std::shared_ptr<Scene> replaced = m_ScenesBuffer[id];
+        scene->SetActiveFlag(id == m_ActiveSceneID);
+        m_ScenesBuffer[id] = scene;
+        
+        LOG_TRACE("Replaced Scene {}", id);
+        return replaced;
+    }
+    
     bool SceneManager::SetActiveScene(uint16_t id)
     {
         if (m_ScenesBuffer.size() <= id)
@@ -18,9 +18,11 @@
 #include <coconuts/ecs/Serializer.h>
 #include <coconuts/Logger.h>
 #include <coconuts/ECS.h>
+#include <coconuts/ecs/Prefab.h>
 #include <coconuts/AssetManager.h>
 #include <coconuts/cameras/OrthographicCamera.h>
 #include <coconuts/SceneManager.h>
+#include <coconuts/graphics/Renderer2D.h>
 
 namespace Coconuts
 {
@@ -32,6 +34,15 @@ namespace Coconuts
         {
             constexpr auto ROOT_NODE_SCENEMANAGER = "<SceneManager>";
             constexpr auto KEY_SEQ_NODE_SCENESLIST = "Scenes List";
+            constexpr auto ROOT_NODE_PREFABLIBRARY = "<PrefabLibrary>";
+            constexpr auto KEY_SEQ_NODE_PREFABSLIST = "Prefabs List";
+            
+            /* Component nodes are the same as an Entity's */
+            namespace PREFAB
+            {
+                constexpr auto CLASS_NODE_PREFAB = "<Prefab>";
+                constexpr auto KEY_STR_NAME = "Name";
+            }
             
             namespace SCENE
             {
@@ -75,6 +86,45 @@ namespace Coconuts
                         constexpr auto CMP_NODE_SPRITECOMPONENT = "SpriteComponent";
                         constexpr auto KEY_STR_SPRITELOGICALNAME = "spriteLogicalName";
                         constexpr auto KEY_SEQ_FLOAT4_TINTCOLOR = "tintColor";
+                        constexpr auto NODE_SAMPLER = "sampler";    // optional
+                    }
+
+                    namespace TILEMAPCOMPONENT
+                    {
+                        constexpr auto CMP_NODE_TILEMAPCOMPONENT = "TilemapComponent";
+                        constexpr auto KEY_STR_TILESETLOGICALNAME = "tilesetLogicalName";
+                        constexpr auto KEY_SEQ_FLOAT2_CELLSIZE = "cellSize";
+                        constexpr auto KEY_SEQ_FLOAT2_TILESIZE = "tileSize";
+                        constexpr auto KEY_UI32_WIDTH = "width";
+                        constexpr auto KEY_UI32_HEIGHT = "height";
+                        constexpr auto KEY_SEQ_FLOAT4_TINTCOLOR = "tintColor";
+                        constexpr auto KEY_BIN_TILES = "tiles";     // base64, uint16 little-endian, row-major
+                        constexpr auto NODE_SAMPLER = "sampler";    // optional
+                    }
+
+                    namespace SPRITEANIMATIONCOMPONENT
+                    {
+                        constexpr auto CMP_NODE_SPRITEANIMATIONCOMPONENT = "SpriteAnimationComponent";
+                        constexpr auto KEY_STR_SPRITESHEETLOGICALNAME = "spriteSheetLogicalName";
+                        constexpr auto KEY_SEQ_FLOAT2_FIRSTCOORDS = "firstCoords";
+                        constexpr auto KEY_SEQ_FLOAT2_CELLSIZE = "cellSize";
+                        constexpr auto KEY_SEQ_FLOAT2_SPRITESIZE = "spriteSize";
+                        constexpr auto KEY_UI32_FRAMESPERROW = "framesPerRow";
+                        constexpr auto KEY_UI32_FRAMECOUNT = "frameCount";
+                        constexpr auto KEY_FLOAT_FRAMESPERSECOND = "framesPerSecond";
+                        constexpr auto KEY_BOOL_LOOP = "loop";
+                        constexpr auto KEY_SEQ_FLOAT4_TINTCOLOR = "tintColor";
+                        constexpr auto KEY_FLOAT_SPEED = "speed";
+                        constexpr auto NODE_SAMPLER = "sampler";    // optional
+                    }
+
+                    /* Sampler node (optional on components that draw textures) */
+                    namespace SAMPLER
+                    {
+                        constexpr auto KEY_SEQ_UI8_FILTERS = "filters";  // [min, mag, mip]
+                        constexpr auto KEY_BOOL_MIPMAPS = "mipmaps";
+                        constexpr auto KEY_SEQ_UI8_WRAP = "wrap";        // [s, t]
+                        constexpr auto KEY_FLOAT_MAXANISOTROPY = "maxAnisotropy";
                     }
 
                     namespace BEHAVIORCOMPONENT
@@ -95,7 +145,52 @@ namespace Coconuts
     } //namespace
     
     
-    static void SerializeComponent(YAML::Emitter& out, TagComponent& component)
+    static void SerializeSampler(YAML::Emitter& out, const SamplerSpecification& spec)
+    {
+        using namespace Parser::ROOT::SCENE::ENTITY::SAMPLER;
+        
+        out << YAML::BeginMap;
+        {
+            out << YAML::Key << KEY_SEQ_UI8_FILTERS << YAML::Flow << YAML::BeginSeq;
+            {
+                out << (uint32_t) spec.minFilter;
+                out << (uint32_t) spec.magFilter;
+                out << (uint32_t) spec.mipFilter;
+            }
+            out << YAML::EndSeq;
+            
+            out << YAML::Key << KEY_BOOL_MIPMAPS << YAML::LongBool << spec.mipmaps;
+            
+            out << YAML::Key << KEY_SEQ_UI8_WRAP << YAML::Flow << YAML::BeginSeq;
+            {
+                out << (uint32_t) spec.wrapS;
+                out << (uint32_t) spec.wrapT;
+            }
+            out << YAML::EndSeq;
+            
+            out << YAML::Key << KEY_FLOAT_MAXANISOTROPY << YAML::Value << spec.maxAnisotropy;
+        }
+        out << YAML::EndMap;
+    }
+    
+    static std::shared_ptr<Sampler> DeserializeSampler(YAML::Node& sampler_node)
+    {
+        using namespace Parser::ROOT::SCENE::ENTITY::SAMPLER;
+        
+        SamplerSpecification spec;
+        spec.minFilter = (TextureFilter) sampler_node[KEY_SEQ_UI8_FILTERS][0].as<uint32_t>();
+        spec.magFilter = (TextureFilter) sampler_node[KEY_SEQ_UI8_FILTERS][1].as<uint32_t>();
+        spec.mipFilter = (TextureFilter) sampler_node[KEY_SEQ_UI8_FILTERS][2].as<uint32_t>();
+        spec.mipmaps = sampler_node[KEY_BOOL_MIPMAPS].as<bool>();
+        spec.wrapS = (TextureWrap) sampler_node[KEY_SEQ_UI8_WRAP][0].as<uint32_t>();
+        spec.wrapT = (TextureWrap) sampler_node[KEY_SEQ_UI8_WRAP][1].as<uint32_t>();
+        spec.maxAnisotropy = sampler_node[KEY_FLOAT_MAXANISOTROPY].as<float>();
+        
+        LOG_TRACE("  sampler = key 0x{:x}", spec.GetKey());
+        return Renderer2D::GetSampler(spec);
+    }
+    
+    static void SerializeComponent(YAML::Emitter& out, const TagComponent& component)
     {
         using namespace Parser::ROOT::SCENE::ENTITY::TAGCOMPONENT;
         
@@ -107,7 +202,7 @@ namespace Coconuts
         out << YAML::EndMap;
     }
     
-    static void SerializeComponent(YAML::Emitter& out, OrthoCameraComponent& component)
+    static void SerializeComponent(YAML::Emitter& out, const OrthoCameraComponent& component)
     {
         using namespace Parser::ROOT::SCENE::ENTITY::ORTHOCAMERACOMPONENT;
         
@@ -130,7 +225,7 @@ namespace Coconuts
         out << YAML::EndMap;
     }
     
-    static void SerializeComponent(YAML::Emitter& out, TransformComponent& component)
+    static void SerializeComponent(YAML::Emitter& out, const TransformComponent& component)
     {
         using namespace Parser::ROOT::SCENE::ENTITY::TRANSFORMCOMPONENT;
         
@@ -144,7 +239,7 @@ namespace Coconuts
         out << YAML::EndMap;
     }
     
-    static void SerializeComponent(YAML::Emitter& out, SpriteComponent& component)
+    static void SerializeComponent(YAML::Emitter& out, const SpriteComponent& component)
     {
         using namespace Parser::ROOT::SCENE::ENTITY::SPRITECOMPONENT;
         
@@ -160,16 +255,136 @@ namespace Coconuts
                 out << component.tintColor.a;
             }
             out << YAML::EndSeq;
+            
+            if (component.sampler != nullptr)
+            {
+                out << YAML::Key << NODE_SAMPLER;
+                SerializeSampler(out, component.sampler->GetSpecification());
+            }
         }
         out << YAML::EndMap;
     }
     
-    static void SerializeComponent(YAML::Emitter& out, BehaviorComponent& component)
+    static void SerializeComponent(YAML::Emitter& out, const TilemapComponent& component)
+    {
+        using namespace Parser::ROOT::SCENE::ENTITY::TILEMAPCOMPONENT;
+        
+        if (component.tilemap == nullptr)
+        {
+            return;
+        }
+        
+        const Tilemap& tilemap = *component.tilemap;
+        
+        /* Tiles as a binary blob: a 256x256 map would be 65k YAML scalars otherwise */
+        const std::vector<uint16_t>& tiles = tilemap.GetTiles();
+        std::vector<unsigned char> blob(tiles.size() * sizeof(uint16_t));
+        for (size_t i = 0; i < tiles.size(); i++)
+        {
+            blob[2 * i + 0] = (unsigned char) (tiles[i] & 0xFF);
+            blob[2 * i + 1] = (unsigned char) (tiles[i] >> 8);
+        }
+        
+        out << YAML::Key << CMP_NODE_TILEMAPCOMPONENT;
+        out << YAML::BeginMap;
+        {
+            out << YAML::Key << KEY_STR_TILESETLOGICALNAME << YAML::Value << component.tilesetLogicalName;
+            out << YAML::Key << KEY_SEQ_FLOAT2_CELLSIZE << YAML::Flow << YAML::BeginSeq << tilemap.GetCellSize().x << tilemap.GetCellSize().y << YAML::EndSeq;
+            out << YAML::Key << KEY_SEQ_FLOAT2_TILESIZE << YAML::Flow << YAML::BeginSeq << tilemap.GetTileSize().x << tilemap.GetTileSize().y << YAML::EndSeq;
+            out << YAML::Key << KEY_UI32_WIDTH << YAML::Value << tilemap.GetWidth();
+            out << YAML::Key << KEY_UI32_HEIGHT << YAML::Value << tilemap.GetHeight();
+            out << YAML::Key << KEY_SEQ_FLOAT4_TINTCOLOR << YAML::Flow << YAML::BeginSeq;
+            {
+                out << tilemap.GetTintColor().r;
+                out << tilemap.GetTintColor().g;
+                out << tilemap.GetTintColor().b;
+                out << tilemap.GetTintColor().a;
+            }
+            out << YAML::EndSeq;
+            out << YAML::Key << KEY_BIN_TILES << YAML::Value << YAML::Binary(blob.data(), blob.size());
+            
+            if (component.sampler != nullptr)
+            {
+                out << YAML::Key << NODE_SAMPLER;
+                SerializeSampler(out, component.sampler->GetSpecification());
+            }
+        }
+        out << YAML::EndMap;
+    }
+    
+    /* Clips are saved as their sprite sheet (an imported Texture2D) and frame grid */
+    static std::tuple<bool, std::string> FindTexture2DLogicalName(const std::shared_ptr<Texture2D>& texture2D)
+    {
+        for (const std::string& logicalName : AssetManager::GetAllTexture2DLogicalNames())
+        {
+            if (AssetManager::GetTexture2D(logicalName) == texture2D)
+            {
+                return std::make_tuple(true, logicalName);
+            }
+        }
+        
+        return std::make_tuple(false, std::string());
+    }
+    
+    static bool SerializeComponent(YAML::Emitter& out, const SpriteAnimationComponent& component)
+    {
+        using namespace Parser::ROOT::SCENE::ENTITY::SPRITEANIMATIONCOMPONENT;
+        
+        if (component.clip == nullptr)
+        {
+            return false;
+        }
+        
+        const SpriteAnimationClip& clip = *component.clip;
+        
+        bool found;
+        std::string spriteSheetLogicalName;
+        std::tie(found, spriteSheetLogicalName) = FindTexture2DLogicalName(clip.GetTexture());
+        if (!found)
+        {
+            return false;
+        }
+        
+        const SpriteAnimationClip::FrameGrid& grid = clip.GetFrameGrid();
+        
+        out << YAML::Key << CMP_NODE_SPRITEANIMATIONCOMPONENT;
+        out << YAML::BeginMap;
+        {
+            out << YAML::Key << KEY_STR_SPRITESHEETLOGICALNAME << YAML::Value << spriteSheetLogicalName;
+            out << YAML::Key << KEY_SEQ_FLOAT2_FIRSTCOORDS << YAML::Flow << YAML::BeginSeq << grid.firstCoords.x << grid.firstCoords.y << YAML::EndSeq;
+            out << YAML::Key << KEY_SEQ_FLOAT2_CELLSIZE << YAML::Flow << YAML::BeginSeq << grid.cellSize.x << grid.cellSize.y << YAML::EndSeq;
+            out << YAML::Key << KEY_SEQ_FLOAT2_SPRITESIZE << YAML::Flow << YAML::BeginSeq << grid.spriteSize.x << grid.spriteSize.y << YAML::EndSeq;
+            out << YAML::Key << KEY_UI32_FRAMESPERROW << YAML::Value << grid.framesPerRow;
+            out << YAML::Key << KEY_UI32_FRAMECOUNT << YAML::Value << clip.GetFrameCount();
+            out << YAML::Key << KEY_FLOAT_FRAMESPERSECOND << YAML::Value << grid.framesPerSecond;
+            out << YAML::Key << KEY_BOOL_LOOP << YAML::Value << clip.IsLooping();
+            out << YAML::Key << KEY_SEQ_FLOAT4_TINTCOLOR << YAML::Flow << YAML::BeginSeq;
+            {
+                out << component.tintColor.r;
+                out << component.tintColor.g;
+                out << component.tintColor.b;
+                out << component.tintColor.a;
+            }
+            out << YAML::EndSeq;
+            out << YAML::Key << KEY_FLOAT_SPEED << YAML::Value << component.speed;
+            
+            if (component.sampler != nullptr)
+            {
+                out << YAML::Key << NODE_SAMPLER;
+                SerializeSampler(out, component.sampler->GetSpecification());
+            }
+        }
+        out << YAML::EndMap;
+        
+        return true;
+    }
+    
+    static void SerializeComponent(YAML::Emitter& out, const BehaviorComponent& component)
     {
         //TODO
     }
     
-    static void SerializeComponent(YAML::Emitter& out, EventHandlerComponent& component)
+    static void SerializeComponent(YAML::Emitter& out, const EventHandlerComponent& component)
     {
         //TODO
     }
@@ -187,37 +402,49 @@ namespace Coconuts
             //TagComponent
             if (entity.HasComponent<TagComponent>())
             {
-                SerializeComponent(out, entity.GetComponent<TagComponent>());
+                SerializeComponent(out, entity.ReadComponent<TagComponent>());
             }
             
             //OrthoCameraComponent
             if (entity.HasComponent<OrthoCameraComponent>())
             {
-                SerializeComponent(out, entity.GetComponent<OrthoCameraComponent>());
+                SerializeComponent(out, entity.ReadComponent<OrthoCameraComponent>());
             }
             
             //TransformComponent
             if (entity.HasComponent<TransformComponent>())
             {
-                SerializeComponent(out, entity.GetComponent<TransformComponent>());
+                SerializeComponent(out, entity.ReadComponent<TransformComponent>());
             }
             
             //SpriteComponent
             if (entity.HasComponent<SpriteComponent>())
             {
-                SerializeComponent(out, entity.GetComponent<SpriteComponent>());
+                SerializeComponent(out, entity.ReadComponent<SpriteComponent>());
+            }
+            
+            //SpriteAnimationComponent
+            if (entity.HasComponent<SpriteAnimationComponent>() && !SerializeComponent(out, entity.ReadComponent<SpriteAnimationComponent>()))
+            {
+                LOG_WARN("Entity '{}' - SpriteAnimation not saved: its sprite sheet is not an imported Texture2D", entity.ReadComponent<TagComponent>().tag);
+            }
+            
+            //TilemapComponent
+            if (entity.HasComponent<TilemapComponent>())
+            {
+                SerializeComponent(out, entity.ReadComponent<TilemapComponent>());
             }
             
             //BehaviorComponent
             if (entity.HasComponent<BehaviorComponent>())
             {
-                SerializeComponent(out, entity.GetComponent<BehaviorComponent>());
+                SerializeComponent(out, entity.ReadComponent<BehaviorComponent>());
             }
             
             //EventHandlerComponent
             if (entity.HasComponent<EventHandlerComponent>())
             {
-                SerializeComponent(out, entity.GetComponent<EventHandlerComponent>());
+                SerializeComponent(out, entity.ReadComponent<EventHandlerComponent>());
             }
         }
         out << YAML::EndMap;
@@ -249,6 +476,37 @@ namespace Coconuts
         out << YAML::EndMap;
     }
     
+    static void SerializePrefab(YAML::Emitter& out, const Prefab& prefab)
+    {
+        using namespace Parser::ROOT::PREFAB;
+        
+        out << YAML::BeginMap;
+        out << YAML::Key << CLASS_NODE_PREFAB;
+        out << YAML::BeginMap;
+        {
+            out << YAML::Key << KEY_STR_NAME << YAML::Value << prefab.name;
+            
+            SerializeComponent(out, prefab.tag);
+            
+            if (prefab.hasTransform)
+            {
+                SerializeComponent(out, prefab.transform);
+            }
+            
+            if (prefab.hasSprite)
+            {
+                SerializeComponent(out, prefab.sprite);
+            }
+            
+            if (prefab.hasAnimation && !SerializeComponent(out, prefab.animation))
+            {
+                LOG_WARN("Prefab '{}' - SpriteAnimation not saved: its sprite sheet is not an imported Texture2D", prefab.name);
+            }
+        }
+        out << YAML::EndMap;
+        out << YAML::EndMap;
+    }
+    
     std::string Serializer::Serialize()
     {
         using namespace Parser::ROOT;
@@ -275,7 +533,20 @@ namespace Coconuts
                 }
                 out << YAML::EndSeq;
             }
-            out << YAML::EndSeq;
+            out << YAML::EndMap;
+            
+            out << YAML::Key << ROOT_NODE_PREFABLIBRARY;
+            out << YAML::BeginMap;
+            {
+                //Prefabs
+                out << YAML::Key << KEY_SEQ_NODE_PREFABSLIST << YAML::Value << YAML::BeginSeq;
+                for (const std::string& name : PrefabLibrary::GetAllNames())
+                {
+                    SerializePrefab(out, *PrefabLibrary::Get(name));
+                }
+                out << YAML::EndSeq;
+            }
+            out << YAML::EndMap;
         }
         out << YAML::EndMap;
        
@@ -356,6 +627,9 @@ namespace Coconuts
         component.size.y = size_y;
         component.rotationRadians = rotationRadians;
         
+        /* Loaded state is where interpolation starts from (not the origin) */
+        component.StorePrevious();
+        
         LOG_TRACE("* TransformComponent");
         LOG_TRACE("  position = [ {}, {} ]", pos_x, pos_y);
         LOG_TRACE("  size = [ {}, {} ]", size_x, size_y);
@@ -387,6 +661,117 @@ namespace Coconuts
         LOG_TRACE("  tintColor = [ {}, {}, {}, {} ]", color_r, color_g, color_b, color_a);
         LOG_TRACE("  tilingFactor = {} hardcoded", 1.0f);
         
+        auto sampler_node = component_node[NODE_SAMPLER];
+        if (sampler_node)
+        {
+            component.sampler = DeserializeSampler(sampler_node);
+        }
+        
+        return true;
+    }
+    
+    static bool DeserializeComponent(YAML::Node& component_node, TilemapComponent& component)
+    {
+        using namespace Parser::ROOT::SCENE::ENTITY::TILEMAPCOMPONENT;
+        
+        std::string tilesetLogicalName = component_node[KEY_STR_TILESETLOGICALNAME].as<std::string>();
+        
+        auto cellsize_node = component_node[KEY_SEQ_FLOAT2_CELLSIZE];
+        glm::vec2 cellSize = { cellsize_node[0].as<float>(), cellsize_node[1].as<float>() };
+        
+        auto tilesize_node = component_node[KEY_SEQ_FLOAT2_TILESIZE];
+        glm::vec2 tileSize = { tilesize_node[0].as<float>(), tilesize_node[1].as<float>() };
+        
+        uint32_t width = component_node[KEY_UI32_WIDTH].as<uint32_t>();
+        uint32_t height = component_node[KEY_UI32_HEIGHT].as<uint32_t>();
+        
+        auto tintcolor_node = component_node[KEY_SEQ_FLOAT4_TINTCOLOR];
+        glm::vec4 tintColor = { tintcolor_node[0].as<float>(), tintcolor_node[1].as<float>(),
+                                tintcolor_node[2].as<float>(), tintcolor_node[3].as<float>() };
+        
+        YAML::Binary blob = component_node[KEY_BIN_TILES].as<YAML::Binary>();
+        if (blob.size() != (size_t) width * height * sizeof(uint16_t))
+        {
+            LOG_ERROR("TilemapComponent - tiles blob has {} bytes, expected {}", blob.size(), width * height * sizeof(uint16_t));
+            return false;
+        }
+        
+        std::vector<uint16_t> tiles(width * height);
+        const unsigned char* bytes = blob.data();
+        for (size_t i = 0; i < tiles.size(); i++)
+        {
+            tiles[i] = (uint16_t) (bytes[2 * i] | (bytes[2 * i + 1] << 8));
+        }
+        
+        /* Update output */
+        component = TilemapComponent(tilesetLogicalName, cellSize, width, height, tileSize);
+        component.tilemap->SetTintColor(tintColor);
+        component.tilemap->SetTiles(tiles);
+        
+        LOG_TRACE("* TilemapComponent");
+        LOG_TRACE("  tilesetLogicalName = {}", tilesetLogicalName);
+        LOG_TRACE("  cellSize = [ {}, {} ]", cellSize.x, cellSize.y);
+        LOG_TRACE("  tileSize = [ {}, {} ]", tileSize.x, tileSize.y);
+        LOG_TRACE("  width x height = {} x {}", width, height);
+        
+        auto sampler_node = component_node[NODE_SAMPLER];
+        if (sampler_node)
+        {
+            component.sampler = DeserializeSampler(sampler_node);
+        }
+        
+        return true;
+    }
+    
+    static bool DeserializeComponent(YAML::Node& component_node, SpriteAnimationComponent& component)
+    {
+        using namespace Parser::ROOT::SCENE::ENTITY::SPRITEANIMATIONCOMPONENT;
+        
+        std::string spriteSheetLogicalName = component_node[KEY_STR_SPRITESHEETLOGICALNAME].as<std::string>();
+        
+        auto firstcoords_node = component_node[KEY_SEQ_FLOAT2_FIRSTCOORDS];
+        glm::vec2 firstCoords = { firstcoords_node[0].as<float>(), firstcoords_node[1].as<float>() };
+        
+        auto cellsize_node = component_node[KEY_SEQ_FLOAT2_CELLSIZE];
+        glm::vec2 cellSize = { cellsize_node[0].as<float>(), cellsize_node[1].as<float>() };
+        
+        auto spritesize_node = component_node[KEY_SEQ_FLOAT2_SPRITESIZE];
+        glm::vec2 spriteSize = { spritesize_node[0].as<float>(), spritesize_node[1].as<float>() };
+        
+        uint32_t framesPerRow = component_node[KEY_UI32_FRAMESPERROW].as<uint32_t>();
+        uint32_t frameCount = component_node[KEY_UI32_FRAMECOUNT].as<uint32_t>();
+        float framesPerSecond = component_node[KEY_FLOAT_FRAMESPERSECOND].as<float>();
+        bool loop = component_node[KEY_BOOL_LOOP].as<bool>();
+        
+        auto tintcolor_node = component_node[KEY_SEQ_FLOAT4_TINTCOLOR];
+        glm::vec4 tintColor = { tintcolor_node[0].as<float>(), tintcolor_node[1].as<float>(),
+                                tintcolor_node[2].as<float>(), tintcolor_node[3].as<float>() };
+        
+        float speed = component_node[KEY_FLOAT_SPEED].as<float>();
+        
+        std::shared_ptr<SpriteAnimationClip> clip(SpriteAnimationClip::Create(AssetManager::GetTexture2D(spriteSheetLogicalName),
+                                                                              firstCoords, cellSize, frameCount, framesPerSecond,
+                                                                              loop, framesPerRow, spriteSize));
+        if (clip == nullptr)
+        {
+            LOG_ERROR("SpriteAnimationComponent - Could not rebuild clip from sprite sheet '{}'", spriteSheetLogicalName);
+            return false;
+        }
+        
+        /* Update output */
+        component = SpriteAnimationComponent(clip, tintColor, speed);
+        
+        LOG_TRACE("* SpriteAnimationComponent");
+        LOG_TRACE("  spriteSheetLogicalName = {}", spriteSheetLogicalName);
+        LOG_TRACE("  firstCoords = [ {}, {} ]", firstCoords.x, firstCoords.y);
+        LOG_TRACE("  frameCount = {} ({} per row) at {} fps", frameCount, framesPerRow, framesPerSecond);
+        
+        auto sampler_node = component_node[NODE_SAMPLER];
+        if (sampler_node)
+        {
+            component.sampler = DeserializeSampler(sampler_node);
+        }
+        
         return true;
     }
     
@@ -469,6 +854,28 @@ namespace Coconuts
             entity.AddComponent<SpriteComponent>() = spriteComponent;
         }
         
+        //SpriteAnimationComponent
+        auto animation_node = entity_node[ENTITY::SPRITEANIMATIONCOMPONENT::CMP_NODE_SPRITEANIMATIONCOMPONENT];
+        if (animation_node)
+        {
+            SpriteAnimationComponent animationComponent;
+            if (DeserializeComponent(animation_node, animationComponent))
+            {
+                entity.AddComponent<SpriteAnimationComponent>() = animationComponent;
+            }
+        }
+        
+        //TilemapComponent
+        auto tilemap_node = entity_node[ENTITY::TILEMAPCOMPONENT::CMP_NODE_TILEMAPCOMPONENT];
+        if (tilemap_node)
+        {
+            TilemapComponent tilemapComponent;
+            if (DeserializeComponent(tilemap_node, tilemapComponent))
+            {
+                entity.AddComponent<TilemapComponent>() = tilemapComponent;
+            }
+        }
+        
         //BehaviorComponent
         auto behavior_node = entity_node[ENTITY::BEHAVIORCOMPONENT::CMP_NODE_BEHAVIORCOMPONENT];
         if (behavior_node)
@@ -530,6 +937,48 @@ namespace Coconuts
         return true;
     }
     
+    static void DeserializePrefab(YAML::Node& prefab_node)
+    {
+        using namespace Parser::ROOT::SCENE;
+        
+        std::string name = prefab_node[Parser::ROOT::PREFAB::KEY_STR_NAME].as<std::string>();
+        
+        LOG_TRACE("Parsing <Prefab> ...");
+        LOG_TRACE("* Name: {}", name);
+        
+        Prefab prefab(name);
+        
+        //TagComponent
+        auto tag_node = prefab_node[ENTITY::TAGCOMPONENT::CMP_NODE_TAGCOMPONENT];
+        if (tag_node)
+        {
+            DeserializeComponent(tag_node, prefab.tag);
+        }
+        
+        //TransformComponent
+        auto transform_node = prefab_node[ENTITY::TRANSFORMCOMPONENT::CMP_NODE_TRANSFORMCOMPONENT];
+        if (transform_node)
+        {
+            prefab.hasTransform = DeserializeComponent(transform_node, prefab.transform);
+        }
+        
+        //SpriteComponent
+        auto sprite_node = prefab_node[ENTITY::SPRITECOMPONENT::CMP_NODE_SPRITECOMPONENT];
+        if (sprite_node)
+        {
+            prefab.hasSprite = DeserializeComponent(sprite_node, prefab.sprite);
+        }
+        
+        //SpriteAnimationComponent
+        auto animation_node = prefab_node[ENTITY::SPRITEANIMATIONCOMPONENT::CMP_NODE_SPRITEANIMATIONCOMPONENT];
+        if (animation_node)
+        {
+            prefab.hasAnimation = DeserializeComponent(animation_node, prefab.animation);
+        }
+        
+        PrefabLibrary::Add(prefab);
+    }
+    
     bool Serializer::Deserialize(std::string& conf)
     {
         bool retVal = false;
@@ -558,6 +1007,28 @@ namespace Coconuts
             }
         }
         
+        /* Optional: projects saved before Prefabs have none */
+        PrefabLibrary::Clear();
+        auto prefablibrary_node = root[ROOT_NODE_PREFABLIBRARY];
+        if (prefablibrary_node)
+        {
+            LOG_TRACE("Parsing <PrefabLibrary> ...");
+            
+            auto prefabs_list = prefablibrary_node[KEY_SEQ_NODE_PREFABSLIST];
+            if (prefabs_list)
+            {
+                for (auto prefab : prefabs_list)
+                {
+                    using namespace Parser::ROOT::PREFAB;
+                    auto prefab_node = prefab[CLASS_NODE_PREFAB];
+                    if (prefab_node)
+                    {
+                        DeserializePrefab(prefab_node);
+                    }
+                }
+            }
+        }
+        
         return retVal;
     }
     
@@ -0,0 +1,262 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/SystemScheduler.h>
+#include <coconuts/debug/Profiler.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <thread>
+
+namespace Coconuts
+{
+    
+    bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+    {
+        if (exclusive || other.exclusive)
+        {
+            return true;
+        }
+        
+        /* Write / write and read / write hazards. Readers share */
+        return (writes & (other.reads | other.writes)).any()
+            || (other.writes & reads).any();
+    }
+    
+    SystemScheduler::SystemScheduler()
+    :   m_Systems(),
+        m_Parallel(true),
+        m_Dirty(true),
+        m_Entities(nullptr),
+        m_Timestep(),
+        m_Waiting(),
+        m_Remaining(0),
+        m_MainThreadGuard(),
+        m_MainThreadReady()
+    {
+    }
+    
+    void SystemScheduler::Register(const std::string& name, const SystemAccess& access, const SystemFunction& function)
+    {
+        for (System& system : m_Systems)
+        {
+            if (system.name == name)
+            {
+                system.access = access;
+                system.function = function;
+                m_Dirty = true;
+                return;
+            }
+        }
+        
+        m_Systems.push_back({ name, access, function, {}, 0 });
+        m_Dirty = true;
+    }
+    
+    void SystemScheduler::Merge(const SystemScheduler& source)
+    {
+        for (const System& system : source.m_Systems)
+        {
+            bool registered = std::any_of(m_Systems.begin(), m_Systems.end(), [&system](const System& own)
+            {
+                return own.name == system.name;
+            });
+            
+            if (!registered)
+            {
+                m_Systems.push_back({ system.name, system.access, system.function, {}, 0 });
+                m_Dirty = true;
+            }
+        }
+        
+        m_Parallel = source.m_Parallel;
+    }
+    
+    bool SystemScheduler::Unregister(const std::string& name)
+    {
+        auto found = std::find_if(m_Systems.begin(), m_Systems.end(), [&name](const System& system)
+        {
+            return system.name == name;
+        });
+        
+        if (found == m_Systems.end())
+        {
+            LOG_WARN("SystemScheduler - No system named {}", name);
+            return false;
+        }
+        
+        m_Systems.erase(found);
+        m_Dirty = true;
+        return true;
+    }
+    
+    void SystemScheduler::Rebuild()
+    {
+        /**
+         * Edges only go from an earlier to a later system, so the graph is
+         * acyclic and registration order is a valid topological order.
+         */
+        for (System& system : m_Systems)
+        {
+            system.successors.clear();
+            system.predecessorCount = 0;
+        }
+        
+        for (uint32_t later = 1; later < m_Systems.size(); later++)
+        {
+            for (uint32_t earlier = 0; earlier < later; earlier++)
+            {
+                if (m_Systems[earlier].access.ConflictsWith(m_Systems[later].access))
+                {
+                    m_Systems[earlier].successors.push_back(later);
+                    m_Systems[later].predecessorCount++;
+                }
+            }
+        }
+        
+        m_Waiting.reset(new std::atomic<uint32_t>[m_Systems.size()]);
+        m_Dirty = false;
+        
+        LOG_DEBUG("SystemScheduler - {} systems, critical path of {}", m_Systems.size(), GetCriticalPathLength());
+    }
+    
+    uint32_t SystemScheduler::GetCriticalPathLength()
+    {
+        if (m_Dirty)
+        {
+            Rebuild();
+        }
+        
+        /* Longest path ending at each system, in topological (registration) order */
+        std::vector<uint32_t> depth(m_Systems.size(), 1);
+        uint32_t longest = 0;
+        
+        for (uint32_t i = 0; i < m_Systems.size(); i++)
+        {
+            for (uint32_t successor : m_Systems[i].successors)
+            {
+                depth[successor] = std::max(depth[successor], depth[i] + 1);
+            }
+            
+            longest = std::max(longest, depth[i]);
+        }
+        
+        return longest;
+    }
+    
+    void SystemScheduler::Run(entityx::EntityManager& entities, Timestep ts)
+    {
+        if (m_Dirty)
+        {
+            Rebuild();
+        }
+        
+        if (m_Systems.empty())
+        {
+            return;
+        }
+        
+        /* Serial: registration order respects every dependency */
+        if (!m_Parallel || !JobSystem::IsInitialized())
+        {
+            for (System& system : m_Systems)
+            {
+                __CCNCORE_PROFILER_SCOPE__ (system.name.c_str())
+                system.function(entities, ts);
+            }
+            
+            return;
+        }
+        
+        m_Entities = &entities;
+        m_Timestep = ts;
+        m_Remaining.store((uint32_t) m_Systems.size(), std::memory_order_relaxed);
+        
+        for (uint32_t i = 0; i < m_Systems.size(); i++)
+        {
+            m_Waiting[i].store(m_Systems[i].predecessorCount, std::memory_order_relaxed);
+        }
+        
+        /* Roots */
+        for (uint32_t i = 0; i < m_Systems.size(); i++)
+        {
+            if (m_Systems[i].predecessorCount == 0)
+            {
+                Dispatch(i);
+            }
+        }
+        
+        /* Run main thread systems as they become ready; help the workers otherwise */
+        while (m_Remaining.load(std::memory_order_acquire) != 0)
+        {
+            uint32_t ready = UINT32_MAX;
+            {
+                std::lock_guard<std::mutex> lock(m_MainThreadGuard);
+                if (!m_MainThreadReady.empty())
+                {
+                    ready = m_MainThreadReady.back();
+                    m_MainThreadReady.pop_back();
+                }
+            }
+            
+            if (ready != UINT32_MAX)
+            {
+                Execute(ready);
+            }
+            else if (!JobSystem::RunOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+        
+        m_Entities = nullptr;
+    }
+    
+    void SystemScheduler::Dispatch(uint32_t index)
+    {
+        if (m_Systems[index].access.mainThread)
+        {
+            std::lock_guard<std::mutex> lock(m_MainThreadGuard);
+            m_MainThreadReady.push_back(index);
+            return;
+        }
+        
+        /* Job name must outlive Run(): the system's own scope is inside Execute() */
+        JobSystem::Schedule([this, index] { Execute(index); }, nullptr, nullptr, "SystemScheduler:System");
+    }
+    
+    void SystemScheduler::Execute(uint32_t index)
+    {
+        System& system = m_Systems[index];
+        
+        {
+            __CCNCORE_PROFILER_SCOPE__ (system.name.c_str())
+            system.function(*m_Entities, m_Timestep);
+        }
+        
+        /* Release systems whose last dependency was this one */
+        for (uint32_t successor : system.successors)
+        {
+            if (m_Waiting[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Dispatch(successor);
+            }
+        }
+        
+        /* Last access to this scheduler: Run() may return right after */
+        m_Remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    
+}
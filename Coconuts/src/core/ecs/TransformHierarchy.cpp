@@ -0,0 +1,327 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/TransformHierarchy.h>
+#include <coconuts/ecs/components/TransformComponent.h>
+#include <coconuts/Logger.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Coconuts
+{
+    
+    TransformHierarchy::Node::Node(entityx::Entity::Id entityId, const TransformComponent* component)
+        :   id(entityId), local(component), parent(NONE), parentPos(NONE), childCount(0),
+            dirty(true), changed(false),
+            position(0.0f), size(0.0f), rotation(0.0f),
+            previousPosition(0.0f), previousSize(0.0f), previousRotation(0.0f),
+            world(1.0f), previousWorld(1.0f)
+    {
+        
+    }
+    
+    TransformHierarchy::TransformHierarchy(entityx::EventManager& events)
+        : m_OrderDirty(false), m_LastUpdateCount(0)
+    {
+        events.subscribe<entityx::ComponentAddedEvent<TransformComponent>>(*this);
+        events.subscribe<entityx::ComponentRemovedEvent<TransformComponent>>(*this);
+    }
+    
+    //static
+    glm::mat4 TransformHierarchy::ComposeLocal(const glm::vec2& position, const glm::vec2& size, float rotationRadians)
+    {
+        return glm::translate(glm::mat4(1.0f), {position.x, position.y, 0.0f})
+               * glm::rotate(glm::mat4(1.0f), -rotationRadians, {0.0f, 0.0f, 1.0f})
+               * glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
+    }
+    
+    void TransformHierarchy::Reserve(size_t nodes, size_t indices)
+    {
+        m_Nodes.reserve(m_Nodes.size() + nodes);
+        if (indices > m_Position.size())
+        {
+            m_Position.resize(indices, (uint32_t) NONE);
+        }
+    }
+    
+    void TransformHierarchy::receive(const entityx::ComponentAddedEvent<TransformComponent>& event)
+    {
+        uint32_t index = event.entity.id().index();
+        if (index >= m_Position.size())
+        {
+            m_Position.resize(index + 1, (uint32_t) NONE);
+        }
+        
+        /* A root at the end keeps parents before children */
+        m_Position[index] = (uint32_t) m_Nodes.size();
+        m_Nodes.emplace_back(event.entity.id(), event.component.get());
+    }
+    
+    void TransformHierarchy::receive(const entityx::ComponentRemovedEvent<TransformComponent>& event)
+    {
+        uint32_t position = Find(event.entity.id());
+        if (position == NONE)
+        {
+            return;
+        }
+        
+        uint32_t index = event.entity.id().index();
+        
+        /* Children stay where they are relative to nothing: they become roots */
+        if (m_Nodes[position].childCount > 0)
+        {
+            for (Node& node : m_Nodes)
+            {
+                if (node.parent == index)
+                {
+                    node.parent = NONE;
+                    node.dirty = true;
+                }
+            }
+        }
+        
+        Detach(position);
+        
+        /* Swap with the last node: it may now come before its parent */
+        m_Nodes[position] = m_Nodes.back();
+        m_Position[m_Nodes[position].id.index()] = position;
+        m_Nodes.pop_back();
+        m_Position[index] = NONE;
+        m_OrderDirty = true;
+    }
+    
+    bool TransformHierarchy::SetParent(entityx::Entity child, entityx::Entity parent)
+    {
+        uint32_t childPos = Find(child.id());
+        uint32_t parentPos = Find(parent.id());
+        
+        if (childPos == NONE || parentPos == NONE)
+        {
+            LOG_WARN("TransformHierarchy - Parent and child need a Transform");
+            return false;
+        }
+        
+        /* Refuse cycles: parent must not be child itself or below it */
+        uint32_t childIndex = child.id().index();
+        uint32_t ancestor = parent.id().index();
+        while (ancestor != NONE)
+        {
+            if (ancestor == childIndex)
+            {
+                LOG_WARN("TransformHierarchy - Entity {} is above {}, can't be its child", child.id().id(), parent.id().id());
+                return false;
+            }
+            
+            ancestor = m_Nodes[m_Position[ancestor]].parent;
+        }
+        
+        Detach(childPos);
+        
+        Node& node = m_Nodes[childPos];
+        node.parent = parent.id().index();
+        node.dirty = true;
+        m_Nodes[parentPos].childCount++;
+        m_OrderDirty = true;
+        
+        return true;
+    }
+    
+    void TransformHierarchy::ClearParent(entityx::Entity child)
+    {
+        uint32_t position = Find(child.id());
+        if (position == NONE || m_Nodes[position].parent == NONE)
+        {
+            return;
+        }
+        
+        Detach(position);
+        m_Nodes[position].dirty = true;
+        
+        /* A root may sit anywhere: order still holds */
+    }
+    
+    entityx::Entity::Id TransformHierarchy::GetParent(entityx::Entity child) const
+    {
+        uint32_t position = Find(child.id());
+        if (position == NONE || m_Nodes[position].parent == NONE)
+        {
+            return entityx::Entity::INVALID;
+        }
+        
+        return m_Nodes[m_Position[m_Nodes[position].parent]].id;
+    }
+    
+    void TransformHierarchy::Detach(uint32_t position)
+    {
+        Node& node = m_Nodes[position];
+        if (node.parent != NONE)
+        {
+            m_Nodes[m_Position[node.parent]].childCount--;
+            node.parent = NONE;
+            node.parentPos = NONE;
+        }
+    }
+    
+    uint32_t TransformHierarchy::Find(entityx::Entity::Id id) const
+    {
+        uint32_t index = id.index();
+        if (index >= m_Position.size() || m_Position[index] == NONE)
+        {
+            return NONE;
+        }
+        
+        uint32_t position = m_Position[index];
+        return (m_Nodes[position].id == id) ? position : NONE;
+    }
+    
+    void TransformHierarchy::Sort()
+    {
+        uint32_t count = (uint32_t) m_Nodes.size();
+        
+        /* Children lists over current positions */
+        m_FirstChild.assign(count, (uint32_t) NONE);
+        m_NextSibling.assign(count, (uint32_t) NONE);
+        m_Order.clear();
+        
+        for (uint32_t i = count; i-- > 0; )
+        {
+            if (m_Nodes[i].parent == NONE)
+            {
+                continue;
+            }
+            
+            uint32_t parent = m_Position[m_Nodes[i].parent];
+            m_NextSibling[i] = m_FirstChild[parent];
+            m_FirstChild[parent] = i;
+        }
+        
+        /* Roots first, then breadth first: depth never decreases along the array */
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (m_Nodes[i].parent == NONE)
+            {
+                m_Order.push_back(i);
+            }
+        }
+        
+        for (size_t k = 0; k < m_Order.size(); k++)
+        {
+            for (uint32_t child = m_FirstChild[m_Order[k]]; child != NONE; child = m_NextSibling[child])
+            {
+                m_Order.push_back(child);
+            }
+        }
+        
+        m_Sorted.clear();
+        m_Sorted.reserve(count);
+        for (uint32_t position : m_Order)
+        {
+            m_Sorted.push_back(m_Nodes[position]);
+            m_Position[m_Sorted.back().id.index()] = (uint32_t) m_Sorted.size() - 1;
+        }
+        
+        m_Nodes.swap(m_Sorted);
+        
+        for (Node& node : m_Nodes)
+        {
+            node.parentPos = (node.parent != NONE) ? m_Position[node.parent] : (uint32_t) NONE;
+        }
+        
+        m_OrderDirty = false;
+    }
+    
+    void TransformHierarchy::Update()
+    {
+        if (m_OrderDirty)
+        {
+            Sort();
+        }
+        
+        uint32_t updated = 0;
+        
+        for (Node& node : m_Nodes)
+        {
+            const TransformComponent& local = *node.local;
+            
+            bool parentChanged = (node.parentPos != NONE) && m_Nodes[node.parentPos].changed;
+            bool localChanged = node.dirty
+                                || local.position != node.position
+                                || local.size != node.size
+                                || local.rotationRadians != node.rotation
+                                || local.previousPosition != node.previousPosition
+                                || local.previousSize != node.previousSize
+                                || local.previousRotationRadians != node.previousRotation;
+            
+            node.changed = parentChanged || localChanged;
+            if (!node.changed)
+            {
+                continue;
+            }
+            
+            node.position = local.position;
+            node.size = local.size;
+            node.rotation = local.rotationRadians;
+            node.previousPosition = local.previousPosition;
+            node.previousSize = local.previousSize;
+            node.previousRotation = local.previousRotationRadians;
+            node.dirty = false;
+            
+            node.world = ComposeLocal(node.position, node.size, node.rotation);
+            node.previousWorld = ComposeLocal(node.previousPosition, node.previousSize, node.previousRotation);
+            
+            if (node.parentPos != NONE)
+            {
+                const Node& parent = m_Nodes[node.parentPos];
+                node.world = parent.world * node.world;
+                node.previousWorld = parent.previousWorld * node.previousWorld;
+            }
+            
+            updated++;
+        }
+        
+        m_LastUpdateCount = updated;
+    }
+    
+    const glm::mat4& TransformHierarchy::GetWorldMatrix(entityx::Entity entity) const
+    {
+        static const glm::mat4 s_Identity(1.0f);
+        
+        uint32_t position = Find(entity.id());
+        return (position != NONE) ? m_Nodes[position].world : s_Identity;
+    }
+    
+    glm::mat4 TransformHierarchy::GetInterpolatedWorldMatrix(entityx::Entity entity, float alpha) const
+    {
+        uint32_t position = Find(entity.id());
+        if (position == NONE)
+        {
+            return glm::mat4(1.0f);
+        }
+        
+        /**
+         * Column wise blend: exact for the translation, a close enough
+         * approximation for the rotation / scale of one simulation step.
+         */
+        const Node& node = m_Nodes[position];
+        glm::mat4 world;
+        for (int c = 0; c < 4; c++)
+        {
+            world[c] = glm::mix(node.previousWorld[c], node.world[c], alpha);
+        }
+        
+        return world;
+    }
+    
+}
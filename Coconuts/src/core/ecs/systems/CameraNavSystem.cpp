@@ -30,7 +30,8 @@ namespace Coconuts
     {
         /* Component retrieval */
         auto& c_camera = GetComponent<OrthoCameraComponent>();
-        auto& c_transform = GetComponent<TransformComponent>();
+        const auto& c_transform = ReadComponent<TransformComponent>();
+        glm::vec2 move = {0.0f, 0.0f};
         
         do
         {
@@ -47,33 +48,38 @@ namespace Coconuts
             /* Left */
             if (Polling::IsKeyPressed(Keyboard::KEY_LEFT))
             {
-                c_transform.position.x -= c_camera.mooveSpeed * ts.GetSeconds();
+                move.x -= c_camera.mooveSpeed * ts.GetSeconds();
             }
 
             /* Right */
             if (Polling::IsKeyPressed(Keyboard::KEY_RIGHT))
             {
-                c_transform.position.x += c_camera.mooveSpeed * ts.GetSeconds();
+                move.x += c_camera.mooveSpeed * ts.GetSeconds();
             }
 
             /* Up */
             if (Polling::IsKeyPressed(Keyboard::KEY_UP))
             {
-                c_transform.position.y += c_camera.mooveSpeed * ts.GetSeconds();
+                move.y += c_camera.mooveSpeed * ts.GetSeconds();
             }
 
             /* Down */
             if (Polling::IsKeyPressed(Keyboard::KEY_DOWN))
             {
-                c_transform.position.y -= c_camera.mooveSpeed * ts.GetSeconds();
+                move.y -= c_camera.mooveSpeed * ts.GetSeconds();
             }
             
         } while (false); //do once
         
+        /* Only a moving camera marks its Transform as changed */
+        if (move.x != 0.0f || move.y != 0.0f)
+        {
+            GetComponent<TransformComponent>().position += move;
+        }
+        
         /* Update Camera's Matrices */
         glm::vec3 pos = {c_transform.position.x, c_transform.position.y, 0.0f};
-        c_camera.camera.SetPosition(pos);
-        c_camera.camera.SetRotation(c_transform.rotationRadians);
+        c_camera.camera.SetTransform(pos, c_transform.rotationRadians);
         c_camera.camera.SetProjection(-c_camera.aspectRatio * c_camera.zoomLevel, c_camera.aspectRatio * c_camera.zoomLevel, -c_camera.zoomLevel, c_camera.zoomLevel);
     }
 
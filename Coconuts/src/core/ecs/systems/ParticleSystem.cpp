@@ -0,0 +1,71 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/systems/ParticleSystem.h>
+#include <coconuts/ecs/SystemScheduler.h>
+
+// ECS components
+#include <coconuts/ecs/components/ParticleEmitterComponent.h>
+#include <coconuts/ecs/components/TransformComponent.h>
+
+namespace Coconuts
+{
+    
+    //static
+    void ParticleSystem::OnUpdate(entityx::EntityManager& entities, Timestep ts)
+    {
+        float seconds = ts.GetSeconds();
+        
+        /* Every emitter owns its pool (and random state): one emitter per job */
+        SystemScheduler::ForEachParallel<TransformComponent, ParticleEmitterComponent>(entities, [seconds]
+        (entityx::Entity thisEntityxEntity, TransformComponent& transform, ParticleEmitterComponent& emitter)
+        {
+            if (emitter.pool == nullptr)
+            {
+                return;
+            }
+            
+            /* Simulate existing particles first, so new ones start at the emitter */
+            emitter.pool->Update(seconds, emitter.props);
+            
+            if (emitter.emitting && emitter.emissionRate > 0.0f)
+            {
+                emitter.emissionDebt += emitter.emissionRate * seconds;
+                
+                uint32_t amount = (uint32_t) emitter.emissionDebt;
+                emitter.emissionDebt -= (float) amount;
+                
+                emitter.pool->Emit(amount, transform.position, emitter.props);
+            }
+        }, 1, "ParticleSystem:OnUpdate");
+    }
+    
+    //static
+    void ParticleSystem::OnRender(entityx::EntityManager& entities)
+    {
+        entities.each<ParticleEmitterComponent>([]
+        (entityx::Entity thisEntityxEntity, ParticleEmitterComponent& emitter)
+        {
+            if (emitter.pool == nullptr)
+            {
+                return;
+            }
+            
+            emitter.pool->Submit(0.0f, emitter.texture, emitter.sampler);
+        });
+    }
+    
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/ecs/systems/SpriteAnimationSystem.h>
+#include <coconuts/ecs/SystemScheduler.h>
+
+// ECS components
+#include <coconuts/ecs/components/SpriteAnimationComponent.h>
+
+namespace Coconuts
+{
+    
+    //static
+    void SpriteAnimationSystem::OnUpdate(entityx::EntityManager& entities, Timestep ts)
+    {
+        float seconds = ts.GetSeconds();
+        
+        /* Animations are independent of each other: chunked over the workers */
+        SystemScheduler::ForEachParallel<SpriteAnimationComponent>(entities, [seconds]
+        (entityx::Entity thisEntityxEntity, SpriteAnimationComponent& anim)
+        {
+            if (!anim.playing || anim.clip == nullptr)
+            {
+                return;
+            }
+            
+            float frameDuration = anim.clip->GetFrameDuration();
+            if (frameDuration <= 0.0f)
+            {
+                return;
+            }
+            
+            anim.elapsed += seconds * anim.speed;
+            if (anim.elapsed < frameDuration)
+            {
+                return;
+            }
+            
+            /* Long frames (hitches) may skip several animation frames at once */
+            uint32_t steps = (uint32_t) (anim.elapsed / frameDuration);
+            anim.elapsed -= steps * frameDuration;
+            
+            uint32_t frameCount = anim.clip->GetFrameCount();
+            uint32_t next = anim.frame + steps;
+            
+            if (next < frameCount)
+            {
+                anim.frame = next;
+            }
+            else if (anim.clip->IsLooping())
+            {
+                anim.frame = next % frameCount;
+            }
+            else
+            {
+                /* Hold last frame */
+                anim.frame = frameCount - 1;
+                anim.elapsed = 0.0f;
+                anim.playing = false;
+            }
+        }, 0, "SpriteAnimationSystem:OnUpdate");
+    }
+    
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/event_system/EventQueue.h>
+#include <coconuts/event_system/WindowEvent.h>
+#include <coconuts/event_system/InputKeyEvent.h>
+#include <coconuts/event_system/InputMouseEvent.h>
+
+namespace Coconuts
+{
+    
+    EventQueue::EventQueue()
+        :   m_Count(0),
+            m_LastMove(NONE),
+            m_LastResize(NONE),
+            m_LastRepeat(NONE),
+            m_Dispatching(false),
+            m_Callback(),
+            m_Stats(),
+            m_BatchQueued(0),
+            m_BatchCoalesced(0),
+            m_BatchDispatched(0)
+    {
+    }
+    
+    bool EventQueue::Push(const Event& event)
+    {
+        Record record = { event.GetEventType(), 0, 0, 0.0, 0.0 };
+        
+        switch (record.type)
+        {
+            case EventType::WindowResize:
+            {
+                const WindowEvent::WindowResize& resize = static_cast<const WindowEvent::WindowResize&>(event);
+                record.x = resize.GetWidth();
+                record.y = resize.GetHeight();
+                break;
+            }
+                
+            case EventType::WindowClose:
+            {
+                break;
+            }
+                
+            case EventType::WindowMinimize:
+            {
+                record.code = static_cast<const WindowEvent::WindowMinimize&>(event).IsMinimized() ? 1 : 0;
+                break;
+            }
+                
+            case EventType::KeyPress:
+            {
+                const InputKeyEvent::KeyPress& press = static_cast<const InputKeyEvent::KeyPress&>(event);
+                record.code = press.GetKeyCode();
+                record.repeats = press.GetRepeatCount();
+                break;
+            }
+                
+            case EventType::KeyRelease:
+            {
+                record.code = static_cast<const InputKeyEvent::KeyRelease&>(event).GetKeyCode();
+                break;
+            }
+                
+            case EventType::MouseButtonPress:
+            {
+                record.code = static_cast<const InputMouseEvent::MouseButtonPress&>(event).GetButtonCode();
+                break;
+            }
+                
+            case EventType::MouseButtonRelease:
+            {
+                record.code = static_cast<const InputMouseEvent::MouseButtonRelease&>(event).GetButtonCode();
+                break;
+            }
+                
+            case EventType::MouseCursorMove:
+            {
+                const InputMouseEvent::MouseCursorMove& move = static_cast<const InputMouseEvent::MouseCursorMove&>(event);
+                record.x = move.GetX();
+                record.y = move.GetY();
+                break;
+            }
+                
+            case EventType::MouseScroll:
+            {
+                const InputMouseEvent::MouseScroll& scroll = static_cast<const InputMouseEvent::MouseScroll&>(event);
+                record.x = scroll.GetOffsetX();
+                record.y = scroll.GetOffsetY();
+                break;
+            }
+                
+            default:
+                return false;
+        }
+        
+        m_BatchQueued++;
+        
+        bool repeat = (record.type == EventType::KeyPress && record.repeats > 0);
+        
+        /* Any other event in between ends a run: merging past it would reorder input */
+        if (record.type != EventType::MouseCursorMove)  m_LastMove = NONE;
+        if (record.type != EventType::WindowResize)     m_LastResize = NONE;
+        if (!repeat)                                    m_LastRepeat = NONE;
+        
+        /* Merge into the pending event of the same kind */
+        if (record.type == EventType::MouseCursorMove && m_LastMove != NONE)
+        {
+            m_Events[m_LastMove].x = record.x;
+            m_Events[m_LastMove].y = record.y;
+            m_BatchCoalesced++;
+            return true;
+        }
+        
+        if (record.type == EventType::WindowResize && m_LastResize != NONE)
+        {
+            m_Events[m_LastResize].x = record.x;
+            m_Events[m_LastResize].y = record.y;
+            m_BatchCoalesced++;
+            return true;
+        }
+        
+        if (repeat && m_LastRepeat != NONE && m_Events[m_LastRepeat].code == record.code)
+        {
+            m_Events[m_LastRepeat].repeats += record.repeats;
+            m_BatchCoalesced++;
+            return true;
+        }
+        
+        uint32_t index = Append(record);
+        
+        /* Nothing is merged into events appended while dispatching */
+        if (index == NONE || m_Dispatching)
+        {
+            return true;
+        }
+        
+        if (record.type == EventType::MouseCursorMove)      m_LastMove = index;
+        else if (record.type == EventType::WindowResize)    m_LastResize = index;
+        else if (repeat)                                    m_LastRepeat = index;
+        
+        return true;
+    }
+    
+    uint32_t EventQueue::Append(const Record& record)
+    {
+        if (m_Count == CAPACITY)
+        {
+            /* Pushed by an event handler: can't flush from here */
+            if (m_Dispatching)
+            {
+                Deliver(record);
+                return NONE;
+            }
+            
+            m_Stats.overflows++;
+            Dispatch();
+        }
+        
+        m_Events[m_Count] = record;
+        return m_Count++;
+    }
+    
+    void EventQueue::Dispatch()
+    {
+        if (m_Dispatching)
+        {
+            return;
+        }
+        
+        m_Dispatching = true;
+        m_LastMove = NONE;
+        m_LastResize = NONE;
+        m_LastRepeat = NONE;
+        
+        /* By index: handlers may push more events, delivered in this batch */
+        for (uint32_t i = 0; i < m_Count; i++)
+        {
+            Deliver(m_Events[i]);
+        }
+        
+        m_Count = 0;
+        m_Dispatching = false;
+        
+        m_Stats.queued = m_BatchQueued;
+        m_Stats.coalesced = m_BatchCoalesced;
+        m_Stats.dispatched = m_BatchDispatched;
+        m_Stats.totalQueued += m_BatchQueued;
+        m_Stats.totalCoalesced += m_BatchCoalesced;
+        m_Stats.totalDispatched += m_BatchDispatched;
+        
+        m_BatchQueued = 0;
+        m_BatchCoalesced = 0;
+        m_BatchDispatched = 0;
+    }
+    
+    void EventQueue::Deliver(const Record& record)
+    {
+        /* No callback yet: dropped */
+        if (!m_Callback)
+        {
+            return;
+        }
+        
+        switch (record.type)
+        {
+            case EventType::WindowResize:
+            {
+                WindowEvent::WindowResize event((unsigned int) record.x, (unsigned int) record.y);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::WindowClose:
+            {
+                WindowEvent::WindowClose event;
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::WindowMinimize:
+            {
+                WindowEvent::WindowMinimize event(record.code != 0);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::KeyPress:
+            {
+                InputKeyEvent::KeyPress event(record.code, record.repeats);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::KeyRelease:
+            {
+                InputKeyEvent::KeyRelease event(record.code);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::MouseButtonPress:
+            {
+                InputMouseEvent::MouseButtonPress event(record.code);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::MouseButtonRelease:
+            {
+                InputMouseEvent::MouseButtonRelease event(record.code);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::MouseCursorMove:
+            {
+                InputMouseEvent::MouseCursorMove event(record.x, record.y);
+                m_Callback(event);
+                break;
+            }
+                
+            case EventType::MouseScroll:
+            {
+                InputMouseEvent::MouseScroll event(record.x, record.y);
+                m_Callback(event);
+                break;
+            }
+                
+            default:
+                return;
+        }
+        
+        m_BatchDispatched++;
+    }
+    
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/Font.h>
+#include <coconuts/Logger.h>
+#include <fstream>
+#include <algorithm>
+
+/* Private copy of the rasterizer shipped with imgui */
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <imgui/imstb_truetype.h>
+
+namespace Coconuts
+{
+    
+    namespace
+    {
+        constexpr uint32_t ATLAS_WIDTH = 1024;
+        constexpr int SDF_PADDING = 6;              // pixels of distance around each glyph
+        constexpr unsigned char SDF_ONEDGE = 128;   // stored value on the outline (0.5)
+        
+        /* Next codepoint of an UTF-8 string (invalid bytes are returned as is) */
+        uint32_t NextCodepoint(const std::string& text, size_t& i)
+        {
+            unsigned char c = (unsigned char) text[i++];
+            
+            int extra = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : (c >= 0xC0) ? 1 : 0;
+            uint32_t codepoint = (extra == 0) ? c : (c & (0x3F >> extra));
+            
+            for (int n = 0; n < extra && i < text.size(); n++)
+            {
+                codepoint = (codepoint << 6) | ((unsigned char) text[i++] & 0x3F);
+            }
+            
+            return codepoint;
+        }
+    }
+    
+    Font::~Font()
+    {
+        delete (stbtt_fontinfo*) m_FontInfo;
+    }
+    
+    //static
+    Font* Font::Create(const std::string& ttfPath,
+                       float rasterHeight,
+                       uint32_t firstCodepoint,
+                       uint32_t lastCodepoint)
+    {
+        std::ifstream file(ttfPath, std::ios::binary);
+        if (!file)
+        {
+            LOG_ERROR("Font - Could not open font file! ( {} )", ttfPath);
+            return nullptr;
+        }
+        
+        Font* font = new Font();
+        font->m_Path = ttfPath;
+        font->m_TTF.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        
+        if (!font->Init(rasterHeight, firstCodepoint, lastCodepoint))
+        {
+            delete font;
+            return nullptr;
+        }
+        
+        return font;
+    }
+    
+    //private
+    bool Font::Init(float rasterHeight, uint32_t firstCodepoint, uint32_t lastCodepoint)
+    {
+        stbtt_fontinfo* info = new stbtt_fontinfo();
+        m_FontInfo = info;
+        
+        if (!stbtt_InitFont(info, m_TTF.data(), stbtt_GetFontOffsetForIndex(m_TTF.data(), 0)))
+        {
+            LOG_ERROR("Font - Invalid TrueType data ( {} )", m_Path);
+            return false;
+        }
+        
+        int ascent, descent, lineGap;
+        stbtt_GetFontVMetrics(info, &ascent, &descent, &lineGap);
+        
+        float pixelScale = stbtt_ScaleForPixelHeight(info, rasterHeight);
+        float invHeight = 1.0f / rasterHeight;
+        m_Scale = pixelScale * invHeight;
+        m_LineHeight = (ascent - descent + lineGap) * m_Scale;
+        m_FirstCodepoint = firstCodepoint;
+        m_Glyphs.assign(lastCodepoint - firstCodepoint + 1, Glyph());
+        
+        /* Rasterize every glyph's SDF and shelf-pack them */
+        struct Bitmap { unsigned char* pixels; int w, h, x, y; };
+        std::vector<Bitmap> bitmaps(m_Glyphs.size());
+        
+        int penX = 0, penY = 0, shelfHeight = 0;
+        
+        for (uint32_t cp = firstCodepoint; cp <= lastCodepoint; cp++)
+        {
+            Glyph& glyph = m_Glyphs[cp - firstCodepoint];
+            Bitmap& bitmap = bitmaps[cp - firstCodepoint];
+            
+            int advance, bearing;
+            stbtt_GetCodepointHMetrics(info, cp, &advance, &bearing);
+            glyph.advance = advance * m_Scale;
+            
+            int xoff = 0, yoff = 0;
+            bitmap.pixels = stbtt_GetCodepointSDF(info, pixelScale, cp, SDF_PADDING, SDF_ONEDGE,
+                                                  (float) SDF_ONEDGE / SDF_PADDING,
+                                                  &bitmap.w, &bitmap.h, &xoff, &yoff);
+            if (bitmap.pixels == nullptr)
+            {
+                /* Blank glyph (e.g. space): advance only */
+                bitmap.w = bitmap.h = 0;
+                continue;
+            }
+            
+            if (penX + bitmap.w > (int) ATLAS_WIDTH)
+            {
+                penX = 0;
+                penY += shelfHeight;
+                shelfHeight = 0;
+            }
+            
+            bitmap.x = penX;
+            bitmap.y = penY;
+            penX += bitmap.w;
+            shelfHeight = std::max(shelfHeight, bitmap.h);
+            
+            /* Bitmap offsets are y down from the pen */
+            glyph.planeMin = glm::vec2((float) xoff, (float) -(yoff + bitmap.h)) * invHeight;
+            glyph.planeMax = glm::vec2((float) (xoff + bitmap.w), (float) -yoff) * invHeight;
+        }
+        
+        uint32_t atlasHeight = 1;
+        while (atlasHeight < (uint32_t) (penY + shelfHeight))
+        {
+            atlasHeight <<= 1;
+        }
+        
+        /**
+         * RGBA: white, distance in alpha.
+         * Bitmap rows are top-down and copied as is, so a glyph's top
+         * row ends up on the lower v coordinate.
+         */
+        std::vector<uint32_t> pixels(ATLAS_WIDTH * atlasHeight, 0x00FFFFFF);
+        
+        for (size_t i = 0; i < bitmaps.size(); i++)
+        {
+            Bitmap& bitmap = bitmaps[i];
+            if (bitmap.pixels == nullptr)
+            {
+                continue;
+            }
+            
+            for (int row = 0; row < bitmap.h; row++)
+            {
+                for (int col = 0; col < bitmap.w; col++)
+                {
+                    uint32_t alpha = bitmap.pixels[row * bitmap.w + col];
+                    pixels[(bitmap.y + row) * ATLAS_WIDTH + bitmap.x + col] = (alpha << 24) | 0x00FFFFFF;
+                }
+            }
+            
+            Glyph& glyph = m_Glyphs[i];
+            glyph.uvMin = { (float) bitmap.x / ATLAS_WIDTH, (float) (bitmap.y + bitmap.h) / atlasHeight };
+            glyph.uvMax = { (float) (bitmap.x + bitmap.w) / ATLAS_WIDTH, (float) bitmap.y / atlasHeight };
+            
+            stbtt_FreeSDF(bitmap.pixels, nullptr);
+        }
+        
+        m_Atlas.reset( Texture2D::Create(ATLAS_WIDTH, atlasHeight, pixels.data(), pixels.size() * sizeof(uint32_t)) );
+        
+        LOG_DEBUG("Font - {} glyphs rasterized into a {}x{} SDF atlas ( {} )",
+                  m_Glyphs.size(), ATLAS_WIDTH, atlasHeight, m_Path);
+        
+        return true;
+    }
+    
+    const Font::TextRun& Font::GetTextRun(const std::string& text)
+    {
+        auto found = m_Runs.find(text);
+        if (found != m_Runs.end())
+        {
+            return found->second;
+        }
+        
+        /* Keep the cache bounded (e.g. ever changing score strings) */
+        if (m_Runs.size() >= MAX_CACHED_RUNS)
+        {
+            m_Runs.clear();
+        }
+        
+        TextRun& run = m_Runs[text];
+        run.size = glm::vec2(0.0f, 1.0f);
+        
+        const stbtt_fontinfo* info = (const stbtt_fontinfo*) m_FontInfo;
+        glm::vec2 pen(0.0f);
+        uint32_t previous = 0;
+        
+        size_t i = 0;
+        while (i < text.size())
+        {
+            uint32_t codepoint = NextCodepoint(text, i);
+            
+            if (codepoint == '\n')
+            {
+                pen = glm::vec2(0.0f, pen.y - m_LineHeight);
+                run.size.y += 1.0f;
+                previous = 0;
+                continue;
+            }
+            
+            const Glyph* glyph = FindGlyph(codepoint);
+            if (glyph == nullptr)
+            {
+                codepoint = '?';
+                glyph = FindGlyph(codepoint);
+                if (glyph == nullptr)
+                {
+                    continue;
+                }
+            }
+            
+            if (previous != 0)
+            {
+                pen.x += stbtt_GetCodepointKernAdvance(info, previous, codepoint) * m_Scale;
+            }
+            
+            if (glyph->planeMax.x > glyph->planeMin.x)
+            {
+                Glyph placed = *glyph;
+                placed.planeMin += pen;
+                placed.planeMax += pen;
+                run.glyphs.push_back(placed);
+            }
+            
+            pen.x += glyph->advance;
+            run.size.x = std::max(run.size.x, pen.x);
+            previous = codepoint;
+        }
+        
+        return run;
+    }
+    
+    //private
+    const Font::Glyph* Font::FindGlyph(uint32_t codepoint) const
+    {
+        if (codepoint < m_FirstCodepoint || codepoint - m_FirstCodepoint >= m_Glyphs.size())
+        {
+            return nullptr;
+        }
+        
+        return &m_Glyphs[codepoint - m_FirstCodepoint];
+    }
+    
+}
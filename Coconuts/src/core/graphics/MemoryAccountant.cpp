@@ -0,0 +1,212 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <coconuts/Logger.h>
+#include <unordered_map>
+#include <mutex>
+
+namespace Coconuts
+{
+
+    namespace
+    {
+        constexpr uint32_t CATEGORIES = static_cast<uint32_t>(MemoryCategory::Count);
+
+        struct Ledger
+        {
+            std::mutex                                  mutex;
+            std::unordered_map<const void*, MemoryRecord> records;
+            uint64_t                                    totals[CATEGORIES]  = {0};
+            uint32_t                                    counts[CATEGORIES]  = {0};
+            uint64_t                                    budgets[CATEGORIES] = {0};
+        };
+
+        /* Resources may be created / destroyed during static init / teardown */
+        Ledger& GetLedger()
+        {
+            static Ledger* s_Ledger = new Ledger();
+            return *s_Ledger;
+        }
+
+        inline uint32_t Index(MemoryCategory category)
+        {
+            return static_cast<uint32_t>(category);
+        }
+    }
+
+
+    //static
+    void MemoryAccountant::Track(const void* owner, MemoryCategory category, uint64_t bytes)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        auto found = ledger.records.find(owner);
+        if (found != ledger.records.end())
+        {
+            /* Reallocation: drop previous size */
+            ledger.totals[Index(found->second.category)] -= found->second.bytes;
+            ledger.counts[Index(found->second.category)]--;
+        }
+
+        ledger.records[owner] = { owner, category, bytes };
+        ledger.totals[Index(category)] += bytes;
+        ledger.counts[Index(category)]++;
+
+        uint64_t budget = ledger.budgets[Index(category)];
+        if (budget != 0 && ledger.totals[Index(category)] > budget)
+        {
+            LOG_WARN("MemoryAccountant - {} over budget ({} / {} bytes)",
+                     GetCategoryName(category), ledger.totals[Index(category)], budget);
+        }
+    }
+
+    //static
+    void MemoryAccountant::Untrack(const void* owner)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        auto found = ledger.records.find(owner);
+        if (found != ledger.records.end())
+        {
+            ledger.totals[Index(found->second.category)] -= found->second.bytes;
+            ledger.counts[Index(found->second.category)]--;
+            ledger.records.erase(found);
+        }
+    }
+
+    //static
+    uint64_t MemoryAccountant::GetBytes(const void* owner)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        auto found = ledger.records.find(owner);
+        return (found != ledger.records.end()) ? found->second.bytes : 0;
+    }
+
+    //static
+    uint64_t MemoryAccountant::GetTotalBytes(MemoryCategory category)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+        return ledger.totals[Index(category)];
+    }
+
+    //static
+    uint32_t MemoryAccountant::GetCount(MemoryCategory category)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+        return ledger.counts[Index(category)];
+    }
+
+    //static
+    uint64_t MemoryAccountant::GetTotalGPUBytes()
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < CATEGORIES; i++)
+        {
+            if (IsGPU(static_cast<MemoryCategory>(i)))
+            {
+                total += ledger.totals[i];
+            }
+        }
+
+        return total;
+    }
+
+    //static
+    uint64_t MemoryAccountant::GetTotalCPUBytes()
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < CATEGORIES; i++)
+        {
+            if (!IsGPU(static_cast<MemoryCategory>(i)))
+            {
+                total += ledger.totals[i];
+            }
+        }
+
+        return total;
+    }
+
+    //static
+    std::vector<MemoryRecord> MemoryAccountant::GetRecords()
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        std::vector<MemoryRecord> records;
+        records.reserve(ledger.records.size());
+
+        for (auto& entry : ledger.records)
+        {
+            records.emplace_back(entry.second);
+        }
+
+        return records;
+    }
+
+    //static
+    void MemoryAccountant::SetBudget(MemoryCategory category, uint64_t bytes)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+        ledger.budgets[Index(category)] = bytes;
+    }
+
+    //static
+    uint64_t MemoryAccountant::GetBudget(MemoryCategory category)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+        return ledger.budgets[Index(category)];
+    }
+
+    //static
+    bool MemoryAccountant::IsOverBudget(MemoryCategory category)
+    {
+        Ledger& ledger = GetLedger();
+        std::lock_guard<std::mutex> lock(ledger.mutex);
+
+        uint64_t budget = ledger.budgets[Index(category)];
+        return (budget != 0 && ledger.totals[Index(category)] > budget);
+    }
+
+    //static
+    const char* MemoryAccountant::GetCategoryName(MemoryCategory category)
+    {
+        switch (category)
+        {
+            case MemoryCategory::Texture2D:             return "Textures 2D";
+            case MemoryCategory::VertexBuffer:          return "Vertex Buffers";
+            case MemoryCategory::IndexBuffer:           return "Index Buffers";
+            case MemoryCategory::FramebufferAttachment: return "Framebuffer Attachments";
+            case MemoryCategory::CPUStaging:            return "CPU Staging";
+            default:                                    return "Unknown";
+        }
+    }
+
+}
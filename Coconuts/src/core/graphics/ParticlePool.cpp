@@ -0,0 +1,237 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/ParticlePool.h>
+#include <coconuts/graphics/Renderer2D.h>
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <algorithm>
+#include <atomic>
+
+#if defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define CCN_PARTICLES_SSE
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define CCN_PARTICLES_NEON
+#endif
+
+namespace Coconuts
+{
+    
+    namespace
+    {
+        constexpr uint32_t LANES = 4;
+        
+        /* Minimal 4-wide float vector over the available instruction set */
+#if defined(CCN_PARTICLES_SSE)
+        typedef __m128 float4;
+        inline float4 Load(const float* p)              { return _mm_loadu_ps(p); }
+        inline void   Store(float* p, float4 v)         { _mm_storeu_ps(p, v); }
+        inline float4 Set(float f)                      { return _mm_set1_ps(f); }
+        inline float4 Add(float4 a, float4 b)           { return _mm_add_ps(a, b); }
+        inline float4 Sub(float4 a, float4 b)           { return _mm_sub_ps(a, b); }
+        inline float4 Mul(float4 a, float4 b)           { return _mm_mul_ps(a, b); }
+        inline float4 Clamp01(float4 v)                 { return _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f)); }
+#elif defined(CCN_PARTICLES_NEON)
+        typedef float32x4_t float4;
+        inline float4 Load(const float* p)              { return vld1q_f32(p); }
+        inline void   Store(float* p, float4 v)         { vst1q_f32(p, v); }
+        inline float4 Set(float f)                      { return vdupq_n_f32(f); }
+        inline float4 Add(float4 a, float4 b)           { return vaddq_f32(a, b); }
+        inline float4 Sub(float4 a, float4 b)           { return vsubq_f32(a, b); }
+        inline float4 Mul(float4 a, float4 b)           { return vmulq_f32(a, b); }
+        inline float4 Clamp01(float4 v)                 { return vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f)); }
+#else
+        struct float4 { float v[LANES]; };
+        inline float4 Load(const float* p)              { float4 r; for (uint32_t i = 0; i < LANES; i++) r.v[i] = p[i]; return r; }
+        inline void   Store(float* p, float4 a)         { for (uint32_t i = 0; i < LANES; i++) p[i] = a.v[i]; }
+        inline float4 Set(float f)                      { float4 r; for (uint32_t i = 0; i < LANES; i++) r.v[i] = f; return r; }
+        inline float4 Add(float4 a, float4 b)           { for (uint32_t i = 0; i < LANES; i++) a.v[i] += b.v[i]; return a; }
+        inline float4 Sub(float4 a, float4 b)           { for (uint32_t i = 0; i < LANES; i++) a.v[i] -= b.v[i]; return a; }
+        inline float4 Mul(float4 a, float4 b)           { for (uint32_t i = 0; i < LANES; i++) a.v[i] *= b.v[i]; return a; }
+        inline float4 Clamp01(float4 a)                 { for (uint32_t i = 0; i < LANES; i++) a.v[i] = std::min(std::max(a.v[i], 0.0f), 1.0f); return a; }
+#endif
+        
+        /* end + (begin - end) * t */
+        inline float4 Lerp(float4 end, float4 delta, float4 t)
+        {
+            return Add(end, Mul(delta, t));
+        }
+        
+        /* A different xorshift seed per pool (never 0), or every emitter sprays the same pattern */
+        uint32_t NextSeed()
+        {
+            static std::atomic<uint32_t> s_Pools(0);
+            
+            uint32_t seed = (s_Pools.fetch_add(1) + 1) * 0x9E3779B9u;
+            seed ^= seed >> 16;
+            seed *= 0x85EBCA6Bu;
+            seed ^= seed >> 13;
+            return seed != 0 ? seed : 0x9E3779B9u;
+        }
+    }
+    
+    
+    ParticlePool::ParticlePool(uint32_t capacity)
+        : m_Capacity(capacity), m_Count(0), m_RandomState(NextSeed())
+    {
+        uint32_t padded = (capacity + LANES - 1) / LANES * LANES;
+        
+        m_PositionX.resize(padded, 0.0f);   m_PositionY.resize(padded, 0.0f);
+        m_VelocityX.resize(padded, 0.0f);   m_VelocityY.resize(padded, 0.0f);
+        m_Life.resize(padded, 0.0f);        m_InvLifetime.resize(padded, 0.0f);
+        m_Size.resize(padded, 0.0f);
+        m_ColorR.resize(padded, 0.0f);      m_ColorG.resize(padded, 0.0f);
+        m_ColorB.resize(padded, 0.0f);      m_ColorA.resize(padded, 0.0f);
+        
+        MemoryAccountant::Track(this, MemoryCategory::CPUStaging, (uint64_t) padded * 11 * sizeof(float));
+    }
+    
+    ParticlePool::~ParticlePool()
+    {
+        MemoryAccountant::Untrack(this);
+    }
+    
+    void ParticlePool::Emit(uint32_t amount, const glm::vec2& position, const ParticleProps& props)
+    {
+        amount = std::min(amount, m_Capacity - m_Count);
+        
+        for (uint32_t n = 0; n < amount; n++)
+        {
+            uint32_t i = m_Count++;
+            
+            float lifetime = props.lifetime + props.lifetimeVariation * (Random() * 2.0f - 1.0f);
+            lifetime = std::max(lifetime, 0.001f);
+            
+            m_PositionX[i]   = position.x;
+            m_PositionY[i]   = position.y;
+            m_VelocityX[i]   = props.velocity.x + props.velocityVariation.x * (Random() * 2.0f - 1.0f);
+            m_VelocityY[i]   = props.velocity.y + props.velocityVariation.y * (Random() * 2.0f - 1.0f);
+            m_Life[i]        = lifetime;
+            m_InvLifetime[i] = 1.0f / lifetime;
+            m_Size[i]        = props.sizeBegin;
+            m_ColorR[i]      = props.colorBegin.r;
+            m_ColorG[i]      = props.colorBegin.g;
+            m_ColorB[i]      = props.colorBegin.b;
+            m_ColorA[i]      = props.colorBegin.a;
+        }
+    }
+    
+    void ParticlePool::Update(float seconds, const ParticleProps& props)
+    {
+        /* Single pass over every stream, LANES particles at a time */
+        const float4 dt      = Set(seconds);
+        const float4 accelX  = Mul(Set(props.acceleration.x), dt);
+        const float4 accelY  = Mul(Set(props.acceleration.y), dt);
+        
+        const float4 sizeEnd = Set(props.sizeEnd);
+        const float4 sizeDelta = Set(props.sizeBegin - props.sizeEnd);
+        const float4 rEnd = Set(props.colorEnd.r), rDelta = Set(props.colorBegin.r - props.colorEnd.r);
+        const float4 gEnd = Set(props.colorEnd.g), gDelta = Set(props.colorBegin.g - props.colorEnd.g);
+        const float4 bEnd = Set(props.colorEnd.b), bDelta = Set(props.colorBegin.b - props.colorEnd.b);
+        const float4 aEnd = Set(props.colorEnd.a), aDelta = Set(props.colorBegin.a - props.colorEnd.a);
+        
+        /* Tail lanes past m_Count are padding: computed and ignored */
+        for (uint32_t i = 0; i < m_Count; i += LANES)
+        {
+            float4 life = Sub(Load(&m_Life[i]), dt);
+            Store(&m_Life[i], life);
+            
+            float4 vx = Add(Load(&m_VelocityX[i]), accelX);
+            float4 vy = Add(Load(&m_VelocityY[i]), accelY);
+            Store(&m_VelocityX[i], vx);
+            Store(&m_VelocityY[i], vy);
+            
+            Store(&m_PositionX[i], Add(Load(&m_PositionX[i]), Mul(vx, dt)));
+            Store(&m_PositionY[i], Add(Load(&m_PositionY[i]), Mul(vy, dt)));
+            
+            /* t: 1 at birth -> 0 at death */
+            float4 t = Clamp01(Mul(life, Load(&m_InvLifetime[i])));
+            
+            Store(&m_Size[i],   Lerp(sizeEnd, sizeDelta, t));
+            Store(&m_ColorR[i], Lerp(rEnd, rDelta, t));
+            Store(&m_ColorG[i], Lerp(gEnd, gDelta, t));
+            Store(&m_ColorB[i], Lerp(bEnd, bDelta, t));
+            Store(&m_ColorA[i], Lerp(aEnd, aDelta, t));
+        }
+        
+        /* Keep live particles packed: move last live particle into each dead slot */
+        uint32_t i = 0;
+        while (i < m_Count)
+        {
+            if (m_Life[i] > 0.0f)
+            {
+                i++;
+                continue;
+            }
+            
+            uint32_t last = --m_Count;
+            m_PositionX[i]   = m_PositionX[last];
+            m_PositionY[i]   = m_PositionY[last];
+            m_VelocityX[i]   = m_VelocityX[last];
+            m_VelocityY[i]   = m_VelocityY[last];
+            m_Life[i]        = m_Life[last];
+            m_InvLifetime[i] = m_InvLifetime[last];
+            m_Size[i]        = m_Size[last];
+            m_ColorR[i]      = m_ColorR[last];
+            m_ColorG[i]      = m_ColorG[last];
+            m_ColorB[i]      = m_ColorB[last];
+            m_ColorA[i]      = m_ColorA[last];
+        }
+    }
+    
+    void ParticlePool::Submit(float z,
+                              const std::shared_ptr<Texture2D>& texture,
+                              const std::shared_ptr<Sampler>& sampler) const
+    {
+        uint32_t submitted = 0;
+        
+        while (submitted < m_Count)
+        {
+            /* As many quads as fit in the current batch */
+            QuadVertex* vertex = nullptr;
+            float textureIndex = 0.0f;
+            uint32_t reserved = Renderer2D::ReserveQuads(m_Count - submitted, vertex, textureIndex, texture, sampler);
+            
+            for (uint32_t i = submitted; i < submitted + reserved; i++)
+            {
+                float half = m_Size[i] * 0.5f;
+                float x0 = m_PositionX[i] - half, x1 = m_PositionX[i] + half;
+                float y0 = m_PositionY[i] - half, y1 = m_PositionY[i] + half;
+                glm::vec4 color = { m_ColorR[i], m_ColorG[i], m_ColorB[i], m_ColorA[i] };
+                
+                *vertex++ = { {x0, y0, z}, color, {0.0f, 0.0f}, textureIndex, 1.0f };
+                *vertex++ = { {x1, y0, z}, color, {1.0f, 0.0f}, textureIndex, 1.0f };
+                *vertex++ = { {x1, y1, z}, color, {1.0f, 1.0f}, textureIndex, 1.0f };
+                *vertex++ = { {x0, y1, z}, color, {0.0f, 1.0f}, textureIndex, 1.0f };
+            }
+            
+            submitted += reserved;
+        }
+    }
+    
+    //private
+    float ParticlePool::Random()
+    {
+        /* xorshift32 */
+        m_RandomState ^= m_RandomState << 13;
+        m_RandomState ^= m_RandomState >> 17;
+        m_RandomState ^= m_RandomState << 5;
+        
+        return (m_RandomState >> 8) * (1.0f / 16777216.0f);
+    }
+    
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/RenderCommandList.h>
+#include <coconuts/graphics/MemoryAccountant.h>
+
+namespace Coconuts
+{
+    
+    constexpr size_t RenderCommandList::BLOCK_SIZE;
+    
+    RenderCommandList::~RenderCommandList()
+    {
+        Clear();
+        MemoryAccountant::Untrack(this);
+    }
+    
+    void* RenderCommandList::Allocate(size_t size, size_t alignment)
+    {
+        /* Current block, then any spare block from previous frames */
+        while (m_BlockIndex < m_Blocks.size())
+        {
+            Block& block = m_Blocks[m_BlockIndex];
+            uintptr_t base = (uintptr_t) block.data.get();
+            uintptr_t aligned = (base + m_Offset + alignment - 1) & ~(uintptr_t) (alignment - 1);
+            
+            if (aligned + size <= base + block.size)
+            {
+                m_Offset = (aligned + size) - base;
+                return (void*) aligned;
+            }
+            
+            m_BlockIndex++;
+            m_Offset = 0;
+        }
+        
+        /* Grow (oversized requests get a block of their own) */
+        Block block;
+        block.size = (size + alignment > BLOCK_SIZE) ? size + alignment : BLOCK_SIZE;
+        block.data.reset(new uint8_t[block.size]);
+        m_Blocks.emplace_back(std::move(block));
+        
+        m_ArenaBytes += m_Blocks.back().size;
+        MemoryAccountant::Track(this, MemoryCategory::CPUStaging, m_ArenaBytes);
+        
+        m_BlockIndex = m_Blocks.size() - 1;
+        m_Offset = 0;
+        return Allocate(size, alignment);
+    }
+    
+    void RenderCommandList::Execute()
+    {
+        for (Command& command : m_Commands)
+        {
+            command.invoke(command.payload);
+            command.destroy(command.payload);
+        }
+        
+        m_Commands.clear();
+        Rewind();
+    }
+    
+    void RenderCommandList::Clear()
+    {
+        for (Command& command : m_Commands)
+        {
+            command.destroy(command.payload);
+        }
+        
+        m_Commands.clear();
+        Rewind();
+    }
+    
+    void RenderCommandList::Rewind()
+    {
+        m_BlockIndex = 0;
+        m_Offset = 0;
+    }
+    
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/RenderThread.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Logger.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace Coconuts
+{
+    
+    namespace
+    {
+        struct RenderThreadState
+        {
+            std::thread                     thread;
+            std::thread::id                 renderThreadID;
+            std::atomic<bool>               running {false};
+            Window*                         window = nullptr;
+            
+            /* Double buffered: game thread records one while the other executes */
+            RenderCommandList               lists[2];
+            uint32_t                        recording = 0;
+            uint32_t                        executing = 0;
+            
+            /* Hand over (guarded by mutex) */
+            std::mutex                      mutex;
+            std::condition_variable         cv;
+            bool                            frameReady = false;
+            bool                            quit = false;
+            const std::function<void()>*    job = nullptr;
+            
+            RenderThreadStatistics          stats;
+            uint32_t                        syncsThisFrame = 0;
+        };
+        
+        /* Resources may be released during static teardown */
+        RenderThreadState& GetState()
+        {
+            static RenderThreadState* s_State = new RenderThreadState();
+            return *s_State;
+        }
+        
+        void RenderLoop()
+        {
+            RenderThreadState& state = GetState();
+            state.window->AttachContext();
+            
+            std::unique_lock<std::mutex> lock(state.mutex);
+            while (true)
+            {
+                state.cv.wait(lock, [&state] { return state.frameReady || state.job != nullptr || state.quit; });
+                
+                /* (1) Sync point: the game thread is blocked, no frame in flight */
+                if (state.job != nullptr)
+                {
+                    const std::function<void()>* job = state.job;
+                    lock.unlock();
+                    (*job)();
+                    lock.lock();
+                    
+                    state.job = nullptr;
+                    state.cv.notify_all();
+                    continue;
+                }
+                
+                /* (2) Execute and present last recorded frame */
+                if (state.frameReady)
+                {
+                    RenderCommandList& list = state.lists[state.executing];
+                    uint32_t commandCount = list.GetCommandCount();
+                    lock.unlock();
+                    
+                    int64_t start = Clock::NowNanoseconds();
+                    list.Execute();
+                    state.window->SwapBuffers();
+                    int64_t elapsed = Clock::NowNanoseconds() - start;
+                    
+                    lock.lock();
+                    state.stats.executeMs = (float) (elapsed * 1.0e-6);
+                    state.stats.commandCount = commandCount;
+                    state.frameReady = false;
+                    state.cv.notify_all();
+                    continue;
+                }
+                
+                /* (3) Stop() */
+                if (state.quit)
+                {
+                    break;
+                }
+            }
+            lock.unlock();
+            
+            state.window->DetachContext();
+        }
+    }
+    
+    
+    //static
+    void RenderThread::Start(Window& window)
+    {
+        RenderThreadState& state = GetState();
+        
+        if (state.running)
+        {
+            LOG_WARN("RenderThread - Already running");
+            return;
+        }
+        
+        state.window = &window;
+        state.quit = false;
+        state.frameReady = false;
+        state.recording = 0;
+        
+        /* Context can only be current on one thread */
+        window.DetachContext();
+        
+        state.thread = std::thread(RenderLoop);
+        state.renderThreadID = state.thread.get_id();
+        state.running = true;
+        
+        LOG_DEBUG("RenderThread - Started");
+    }
+    
+    //static
+    void RenderThread::Stop()
+    {
+        RenderThreadState& state = GetState();
+        
+        if (!state.running)
+        {
+            return;
+        }
+        
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cv.wait(lock, [&state] { return !state.frameReady && state.job == nullptr; });
+            state.quit = true;
+        }
+        state.cv.notify_all();
+        state.thread.join();
+        
+        state.running = false;
+        state.window->AttachContext();
+        
+        /* Whatever was recorded after the last EndFrame() (e.g. releases) */
+        state.lists[state.recording].Execute();
+        
+        LOG_DEBUG("RenderThread - Stopped");
+    }
+    
+    //static
+    bool RenderThread::IsRunning()
+    {
+        return GetState().running;
+    }
+    
+    //static
+    bool RenderThread::IsRecording()
+    {
+        RenderThreadState& state = GetState();
+        return state.running && std::this_thread::get_id() != state.renderThreadID;
+    }
+    
+    //static
+    const void* RenderThread::Copy(const void* data, size_t size)
+    {
+        if (!IsRecording() || data == nullptr)
+        {
+            return data;
+        }
+        
+        void* copy = GetRecordingList().Allocate(size);
+        std::memcpy(copy, data, size);
+        return copy;
+    }
+    
+    //static
+    void RenderThread::Sync(const std::function<void()>& job)
+    {
+        if (!IsRecording())
+        {
+            job();
+            return;
+        }
+        
+        RenderThreadState& state = GetState();
+        std::unique_lock<std::mutex> lock(state.mutex);
+        
+        /* Let the in-flight frame finish first */
+        state.cv.wait(lock, [&state] { return !state.frameReady; });
+        
+        state.job = &job;
+        state.cv.notify_all();
+        state.cv.wait(lock, [&state] { return state.job == nullptr; });
+        
+        state.syncsThisFrame++;
+    }
+    
+    //static
+    void RenderThread::EndFrame()
+    {
+        RenderThreadState& state = GetState();
+        
+        if (!state.running)
+        {
+            return;
+        }
+        
+        int64_t start = Clock::NowNanoseconds();
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            
+            /* Frame N-1 must be done before its list can be recorded into again */
+            state.cv.wait(lock, [&state] { return !state.frameReady; });
+            
+            state.executing = state.recording;
+            state.recording ^= 1;
+            state.frameReady = true;
+            
+            state.stats.gameWaitMs = (float) ((Clock::NowNanoseconds() - start) * 1.0e-6);
+            state.stats.syncCount = state.syncsThisFrame;
+            state.syncsThisFrame = 0;
+        }
+        state.cv.notify_all();
+    }
+    
+    //static
+    RenderThreadStatistics RenderThread::GetStatistics()
+    {
+        RenderThreadState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.stats;
+    }
+    
+    //static
+    RenderCommandList& RenderThread::GetRecordingList()
+    {
+        RenderThreadState& state = GetState();
+        return state.lists[state.recording];
+    }
+    
+}
@@ -16,6 +16,7 @@
 
 #include <coconuts/graphics/Renderer2D.h>
 #include <coconuts/graphics/LowLevelAPI.h>
+#include <coconuts/graphics/MemoryAccountant.h>
 #include "glm/ext/matrix_transform.hpp"
 #include <string>
 
@@ -35,6 +36,9 @@ namespace Coconuts
         /* s_Data allocation and initialization */
         s_Data = new Renderer2DStorage();
         s_Data->batchRenderState.quadVertexBuffer_Base = new QuadVertex[s_Data->batchRenderState.maxVertices];
+        MemoryAccountant::Track(s_Data->batchRenderState.quadVertexBuffer_Base,
+                                MemoryCategory::CPUStaging,
+                                s_Data->batchRenderState.maxVertices * sizeof(QuadVertex));
         s_Data->vertexArray.reset( VertexArray::Create() );
         s_Data->vertexBuffer.reset( VertexBuffer::Create(s_Data->batchRenderState.maxVertices * sizeof(QuadVertex)) );
         s_Data->shader.reset( Shader::Create() );
@@ -44,18 +48,10 @@ namespace Coconuts
         s_Data->texture2D_Blank.reset(Texture2D::Create(1, 1, &whiteTexData, sizeof(whiteTexData)));
         /* Store it on Texture Slot index '0' */
         s_Data->batchRenderState.textureSlots[0] = s_Data->texture2D_Blank;
-        
-        /* Vertex Buffer layout -> Vertex Shader */
-        BufferLayout layout = {
-            { ShaderDataType::Float3, "a_Position" },   /* QuadVertex:: glm::vec3 position */
-            { ShaderDataType::Float4, "a_Color" },      /* QuadVertex:: glm::vec4 color */
-            { ShaderDataType::Float2, "a_TexCoord" },   /* QuadVertex:: glm::vec2 texCoord */
-            { ShaderDataType::Float, "a_TexIndex" },    /* QuadVertex:: foat texIndex */
-            { ShaderDataType::Float, "a_TilingFactor" } /* QuadVertex:: foat tilingFactor */
-        };
+        s_Data->batchRenderState.distanceFieldSlots.fill(false);
         
         /* Init VertexBuffer with the layout */
-        s_Data->vertexBuffer->SetLayout(layout);
+        s_Data->vertexBuffer->SetLayout(GetQuadVertexLayout());
 
         /* Init Index Buffer with indices */
         std::shared_ptr<Coconuts::IndexBuffer> indexBuffer;
@@ -77,6 +73,7 @@ namespace Coconuts
         
         indexBuffer.reset( IndexBuffer::Create(indices, s_Data->batchRenderState.maxIndices) );
         delete[] indices;
+        s_Data->quadIndexBuffer = indexBuffer;
 
         /* Set Vertex Array */
         s_Data->vertexArray->AddVertexBuffer(s_Data->vertexBuffer);
@@ -108,6 +105,8 @@ namespace Coconuts
     
     void Renderer2D::Shutdown()
     {
+        MemoryAccountant::Untrack(s_Data->batchRenderState.quadVertexBuffer_Base);
+        delete[] s_Data->batchRenderState.quadVertexBuffer_Base;
         delete s_Data;
     }
     
@@ -137,20 +136,176 @@ namespace Coconuts
     
     void Renderer2D::Flush()
     {
+        int distanceFieldMask = 0;
+        
         /* Bind all textures currently in use */
         for (uint32_t i = 0; i < s_Data->batchRenderState.textureSlotsIndex; i++)
         {
+            if (s_Data->batchRenderState.distanceFieldSlots[i])
+            {
+                distanceFieldMask |= (1 << i);
+            }
+            
             /* Bind in the same shader texture-unit as its slot */
             s_Data->batchRenderState.textureSlots[i]->Bind(i);
+            
+            /* Sampler override (or texture's own sampling) */
+            if (s_Data->batchRenderState.samplerSlots[i] != nullptr)
+            {
+                s_Data->batchRenderState.samplerSlots[i]->Bind(i);
+            }
+            else
+            {
+                Sampler::Unbind(i);
+            }
         }
         
+        /* Nothing batched (DrawIndexed would take a count of 0 as "whole index buffer") */
+        if (s_Data->batchRenderState.indicesCounter == 0)
+        {
+            return;
+        }
+        
+        s_Data->shader->SetInt1("u_SdfMask", distanceFieldMask);
+        
         /* Draw Call -> GPU */
+        s_Data->vertexArray->Bind();
         Graphics::LowLevelAPI::DrawIndexed(s_Data->vertexArray, s_Data->batchRenderState.indicesCounter);
         
         /* Update stats */
         s_Data->stats.drawCalls++;
     }
     
+    void Renderer2D::DrawCachedQuads(const std::shared_ptr<VertexArray>& vertexArray,
+                                     uint32_t quadCount,
+                                     const std::shared_ptr<Texture2D>& texture,
+                                     const std::shared_ptr<Sampler>& sampler)
+    {
+        if (quadCount == 0)
+        {
+            return;
+        }
+        
+        /* Whatever was batched so far goes first */
+        FlushAndReset();
+        
+        const uint32_t slot = BatchRender::cachedQuadsTextureSlot;
+        texture->Bind(slot);
+        s_Data->shader->SetInt1("u_SdfMask", 0);
+        
+        if (sampler != nullptr)
+        {
+            sampler->Bind(slot);
+        }
+        else
+        {
+            Sampler::Unbind(slot);
+        }
+        
+        /* Draw Call -> GPU */
+        vertexArray->Bind();
+        Graphics::LowLevelAPI::DrawIndexed(vertexArray, quadCount * BatchRender::indicesPerQuad);
+        s_Data->vertexArray->Bind();
+        
+        /* Update stats */
+        s_Data->stats.drawCalls++;
+        s_Data->stats.quadCount += quadCount;
+    }
+    
+    // Text
+    void Renderer2D::DrawString(const std::string& text,
+                                const std::shared_ptr<Font>& font,
+                                const glm::vec2& position,
+                                float size,
+                                const glm::vec4& color)
+    {
+        DrawString(text, font, {position.x, position.y, 0.0f}, size, color);
+    }
+    
+    // Text
+    void Renderer2D::DrawString(const std::string& text,
+                                const std::shared_ptr<Font>& font,
+                                const glm::vec3& position,
+                                float size,
+                                const glm::vec4& color)
+    {
+        const Font::TextRun& run = font->GetTextRun(text);
+        const uint32_t count = run.glyphs.size();
+        
+        uint32_t submitted = 0;
+        while (submitted < count)
+        {
+            QuadVertex* vertex = nullptr;
+            float textureIndex = 0.0f;
+            uint32_t reserved = ReserveQuads(count - submitted, vertex, textureIndex, font->GetAtlas(), nullptr, true);
+            
+            for (uint32_t i = submitted; i < submitted + reserved; i++)
+            {
+                const Font::Glyph& glyph = run.glyphs[i];
+                glm::vec2 min = glm::vec2(position) + glyph.planeMin * size;
+                glm::vec2 max = glm::vec2(position) + glyph.planeMax * size;
+                
+                *vertex++ = { {min.x, min.y, position.z}, color, {glyph.uvMin.x, glyph.uvMin.y}, textureIndex, 1.0f };
+                *vertex++ = { {max.x, min.y, position.z}, color, {glyph.uvMax.x, glyph.uvMin.y}, textureIndex, 1.0f };
+                *vertex++ = { {max.x, max.y, position.z}, color, {glyph.uvMax.x, glyph.uvMax.y}, textureIndex, 1.0f };
+                *vertex++ = { {min.x, max.y, position.z}, color, {glyph.uvMin.x, glyph.uvMax.y}, textureIndex, 1.0f };
+            }
+            
+            submitted += reserved;
+        }
+    }
+    
+    //static
+    uint32_t Renderer2D::ReserveQuads(uint32_t count,
+                                      QuadVertex*& vertices,
+                                      float& textureIndex,
+                                      const std::shared_ptr<Texture2D>& texture,
+                                      const std::shared_ptr<Sampler>& sampler,
+                                      bool distanceField)
+    {
+        /* Max indices reached -> Draw Call + Restart Batch */
+        if (s_Data->batchRenderState.indicesCounter >= s_Data->batchRenderState.maxIndices)
+        {
+            FlushAndReset();
+        }
+        
+        /* May flush too (texture slots full), which only frees more room */
+        textureIndex = (texture != nullptr) ? GetTextureSlotIndex(texture, sampler, distanceField) : 0.0f;
+        
+        uint32_t freeQuads = (s_Data->batchRenderState.maxIndices - s_Data->batchRenderState.indicesCounter) / s_Data->batchRenderState.indicesPerQuad;
+        uint32_t reserved = (count < freeQuads) ? count : freeQuads;
+        
+        vertices = s_Data->batchRenderState.quadVertexBuffer_Ptr;
+        s_Data->batchRenderState.quadVertexBuffer_Ptr += reserved * s_Data->batchRenderState.verticesPerQuad;
+        s_Data->batchRenderState.indicesCounter += reserved * s_Data->batchRenderState.indicesPerQuad;
+        
+        /* Update stats */
+        s_Data->stats.quadCount += reserved;
+        
+        return reserved;
+    }
+    
+    //static
+    BufferLayout Renderer2D::GetQuadVertexLayout()
+    {
+        /* Vertex Buffer layout -> Vertex Shader */
+        BufferLayout layout = {
+            { ShaderDataType::Float3, "a_Position" },   /* QuadVertex:: glm::vec3 position */
+            { ShaderDataType::Float4, "a_Color" },      /* QuadVertex:: glm::vec4 color */
+            { ShaderDataType::Float2, "a_TexCoord" },   /* QuadVertex:: glm::vec2 texCoord */
+            { ShaderDataType::Float, "a_TexIndex" },    /* QuadVertex:: foat texIndex */
+            { ShaderDataType::Float, "a_TilingFactor" } /* QuadVertex:: foat tilingFactor */
+        };
+        
+        return layout;
+    }
+    
+    //static
+    std::shared_ptr<IndexBuffer> Renderer2D::GetQuadIndexBuffer()
+    {
+        return s_Data->quadIndexBuffer;
+    }
+    
     void Renderer2D::FlushAndReset()
     {
         // Same as EndScene() without unbinding the shader
@@ -182,6 +337,64 @@ namespace Coconuts
         return s_Data->stats;
     }
     
+    //private static
+    float Renderer2D::GetTextureSlotIndex(const std::shared_ptr<Texture2D>& texture,
+                                          const std::shared_ptr<Sampler>& sampler,
+                                          bool distanceField)
+    {
+        /**
+         * A slot is a (texture, sampler) pair: the same texture drawn with
+         * two samplers is bound to two units, without copying texture data.
+         */
+        for (uint32_t i = 1; i < s_Data->batchRenderState.textureSlotsIndex; i++)
+        {
+            if (*s_Data->batchRenderState.textureSlots[i].get() == *texture.get() &&
+                s_Data->batchRenderState.samplerSlots[i] == sampler &&
+                s_Data->batchRenderState.distanceFieldSlots[i] == distanceField)
+            {
+                // we found inside a texture slot, a texture equal (same ID)
+                // to the texture we want to draw now
+                return (float) i;
+            }
+        }
+        
+        /* The texture is "new" (not set to a texture slot before) */
+        
+        /* Max Texture slots reached -> Draw Call + Restart Batch */
+        if (s_Data->batchRenderState.textureSlotsIndex >= s_Data->batchRenderState.maxTextureSlots)
+        {
+            FlushAndReset();    // Resets s_Data->batchRenderState.textureSlotsIndex
+        }
+        
+        uint32_t slot = s_Data->batchRenderState.textureSlotsIndex;
+        
+        /* Set it into a slot */
+        s_Data->batchRenderState.textureSlots[slot] = texture;
+        s_Data->batchRenderState.samplerSlots[slot] = sampler;
+        s_Data->batchRenderState.distanceFieldSlots[slot] = distanceField;
+        s_Data->batchRenderState.textureSlotsIndex++;
+        
+        return (float) slot;
+    }
+    
+    //static
+    std::shared_ptr<Sampler> Renderer2D::GetSampler(const SamplerSpecification& spec)
+    {
+        uint64_t key = spec.GetKey();
+        auto found = s_Data->samplers.find(key);
+        
+        if (found != s_Data->samplers.end())
+        {
+            return found->second;
+        }
+        
+        std::shared_ptr<Sampler> sampler;
+        sampler.reset( Sampler::Create(spec) );
+        s_Data->samplers[key] = sampler;
+        
+        return sampler;
+    }
+    
     // Color
     void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
     {
@@ -343,34 +556,7 @@ namespace Coconuts
          * Set them all.
          */
         
-        float textureIndex = 0.0f;
-        for (uint32_t i = 1; i < s_Data->batchRenderState.textureSlotsIndex; i++)
-        {
-            if (*s_Data->batchRenderState.textureSlots[i].get() == *texture.get())
-            {
-                textureIndex = (float) i;
-                
-                // we found inside a texture slot, a texture equal (same ID)
-                // to the texture we want to draw now
-                break;
-            }
-        }
-        
-        /* If the texture is "new" (not set to a texture slot before) */
-        if (textureIndex == 0.0f)
-        {
-            /* Max Texture slots reached -> Draw Call + Restart Batch */
-            if (s_Data->batchRenderState.textureSlotsIndex >= s_Data->batchRenderState.maxTextureSlots)
-            {
-                FlushAndReset();    // Resets s_Data->batchRenderState.textureSlotsIndex
-            }
-            
-            textureIndex = (float) s_Data->batchRenderState.textureSlotsIndex;
-            
-            /* Set it into a slot */
-            s_Data->batchRenderState.textureSlots[s_Data->batchRenderState.textureSlotsIndex] = texture;
-            s_Data->batchRenderState.textureSlotsIndex++;
-        }
+        float textureIndex = GetTextureSlotIndex(texture, nullptr);
         
         /* Transform matrix */
         glm::mat4 transform =
@@ -445,34 +631,7 @@ namespace Coconuts
          * Set them all.
          */
         
-        float textureIndex = 0.0f;
-        for (uint32_t i = 1; i < s_Data->batchRenderState.textureSlotsIndex; i++)
-        {
-            if (*s_Data->batchRenderState.textureSlots[i].get() == *texture.get())
-            {
-                textureIndex = (float) i;
-                
-                // we found inside a texture slot, a texture equal (same ID)
-                // to the texture we want to draw now
-                break;
-            }
-        }
-        
-        /* If the texture is "new" (not set to a texture slot before) */
-        if (textureIndex == 0.0f)
-        {
-            /* Max Texture slots reached -> Draw Call + Restart Batch */
-            if (s_Data->batchRenderState.textureSlotsIndex >= s_Data->batchRenderState.maxTextureSlots)
-            {
-                FlushAndReset();    // Resets s_Data->batchRenderState.textureSlotsIndex
-            }
-            
-            textureIndex = (float) s_Data->batchRenderState.textureSlotsIndex;
-            
-            /* Set it into a slot */
-            s_Data->batchRenderState.textureSlots[s_Data->batchRenderState.textureSlotsIndex] = texture;
-            s_Data->batchRenderState.textureSlotsIndex++;
-        }
+        float textureIndex = GetTextureSlotIndex(texture, nullptr);
         
         /* Transform matrix */
         glm::mat4 transform =
@@ -523,9 +682,10 @@ namespace Coconuts
                               const glm::vec2& size,
                               const std::shared_ptr<Sprite>& sprite,
                               float tilingFactor,
-                              const glm::vec4& tintColor)
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
     {
-        DrawQuad({position.x, position.y, 0.0f}, size, sprite, tilingFactor, tintColor);
+        DrawQuad({position.x, position.y, 0.0f}, size, sprite, tilingFactor, tintColor, sampler);
     }
     
     // Sprite
@@ -533,7 +693,8 @@ namespace Coconuts
                               const glm::vec2& size,
                               const std::shared_ptr<Sprite>& sprite,
                               float tilingFactor,
-                              const glm::vec4& tintColor)
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
     {
         const glm::vec2* textureCoords              = sprite->GetTextureCoords();
         const std::shared_ptr<Texture2D> texture    = sprite->GetTexture();
@@ -549,34 +710,7 @@ namespace Coconuts
          * Set them all.
          */
         
-        float textureIndex = 0.0f;
-        for (uint32_t i = 1; i < s_Data->batchRenderState.textureSlotsIndex; i++)
-        {
-            if (*s_Data->batchRenderState.textureSlots[i].get() == *texture.get())
-            {
-                textureIndex = (float) i;
-                
-                // we found inside a texture slot, a texture equal (same ID)
-                // to the texture we want to draw now
-                break;
-            }
-        }
-        
-        /* If the texture is "new" (not set to a texture slot before) */
-        if (textureIndex == 0.0f)
-        {
-            /* Max Texture slots reached -> Draw Call + Restart Batch */
-            if (s_Data->batchRenderState.textureSlotsIndex >= s_Data->batchRenderState.maxTextureSlots)
-            {
-                FlushAndReset();    // Resets s_Data->batchRenderState.textureSlotsIndex
-            }
-            
-            textureIndex = (float) s_Data->batchRenderState.textureSlotsIndex;
-            
-            /* Set it into a slot */
-            s_Data->batchRenderState.textureSlots[s_Data->batchRenderState.textureSlotsIndex] = texture;
-            s_Data->batchRenderState.textureSlotsIndex++;
-        }
+        float textureIndex = GetTextureSlotIndex(texture, sampler);
         
         /* Transform matrix */
         glm::mat4 transform =
@@ -627,9 +761,10 @@ namespace Coconuts
                               float rotation_radians,
                               const std::shared_ptr<Sprite>& sprite,
                               float tilingFactor,
-                              const glm::vec4& tintColor)
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
     {
-        DrawRotatedQuad({position.x, position.y, 0.0f}, size, rotation_radians, sprite, tilingFactor, tintColor);
+        DrawRotatedQuad({position.x, position.y, 0.0f}, size, rotation_radians, sprite, tilingFactor, tintColor, sampler);
     }
     
     // Sprite + Rotation
@@ -638,11 +773,49 @@ namespace Coconuts
                               float rotation_radians,
                               const std::shared_ptr<Sprite>& sprite,
                               float tilingFactor,
-                              const glm::vec4& tintColor)
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
     {
-        const glm::vec2* textureCoords              = sprite->GetTextureCoords();
-        const std::shared_ptr<Texture2D> texture    = sprite->GetTexture();
+        DrawRotatedQuad(position, size, rotation_radians, sprite->GetTexture(), sprite->GetTextureCoords(), tilingFactor, tintColor, sampler);
+    }
+    
+    // Texture region + Rotation
+    void Renderer2D::DrawRotatedQuad(const glm::vec3& position,
+                              const glm::vec2& size,
+                              float rotation_radians,
+                              const std::shared_ptr<Texture2D>& texture,
+                              const glm::vec2* textureCoords,
+                              float tilingFactor,
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
+    {
+        /* Transform matrix */
+        glm::mat4 transform =
+                glm::translate(glm::mat4(1.0f), position)
+                * glm::rotate(glm::mat4(1.0f), -rotation_radians, {0.0f, 0.0f, 0.1f})
+                * glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
         
+        DrawQuad(transform, texture, textureCoords, tilingFactor, tintColor, sampler);
+    }
+    
+    // Sprite + World matrix
+    void Renderer2D::DrawQuad(const glm::mat4& transform,
+                              const std::shared_ptr<Sprite>& sprite,
+                              float tilingFactor,
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
+    {
+        DrawQuad(transform, sprite->GetTexture(), sprite->GetTextureCoords(), tilingFactor, tintColor, sampler);
+    }
+    
+    // Texture region + World matrix
+    void Renderer2D::DrawQuad(const glm::mat4& transform,
+                              const std::shared_ptr<Texture2D>& texture,
+                              const glm::vec2* textureCoords,
+                              float tilingFactor,
+                              const glm::vec4& tintColor,
+                              const std::shared_ptr<Sampler>& sampler)
+    {
         /* Max indices reached -> Draw Call + Restart Batch */
         if (s_Data->batchRenderState.indicesCounter >= s_Data->batchRenderState.maxIndices)
         {
@@ -654,40 +827,7 @@ namespace Coconuts
          * Set them all.
          */
         
-        float textureIndex = 0.0f;
-        for (uint32_t i = 1; i < s_Data->batchRenderState.textureSlotsIndex; i++)
-        {
-            if (*s_Data->batchRenderState.textureSlots[i].get() == *texture.get())
-            {
-                textureIndex = (float) i;
-                
-                // we found inside a texture slot, a texture equal (same ID)
-                // to the texture we want to draw now
-                break;
-            }
-        }
-        
-        /* If the texture is "new" (not set to a texture slot before) */
-        if (textureIndex == 0.0f)
-        {
-            /* Max Texture slots reached -> Draw Call + Restart Batch */
-            if (s_Data->batchRenderState.textureSlotsIndex >= s_Data->batchRenderState.maxTextureSlots)
-            {
-                FlushAndReset();    // Resets s_Data->batchRenderState.textureSlotsIndex
-            }
-            
-            textureIndex = (float) s_Data->batchRenderState.textureSlotsIndex;
-            
-            /* Set it into a slot */
-            s_Data->batchRenderState.textureSlots[s_Data->batchRenderState.textureSlotsIndex] = texture;
-            s_Data->batchRenderState.textureSlotsIndex++;
-        }
-        
-        /* Transform matrix */
-        glm::mat4 transform =
-                glm::translate(glm::mat4(1.0f), position)
-                * glm::rotate(glm::mat4(1.0f), -rotation_radians, {0.0f, 0.0f, 0.1f})
-                * glm::scale(glm::mat4(1.0f), {size.x, size.y, 1.0f});
+        float textureIndex = GetTextureSlotIndex(texture, sampler);
         
         // 0
         s_Data->batchRenderState.quadVertexBuffer_Ptr->position     = transform * s_Data->batchRenderState.quadVertexPositions[0];
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/Sampler.h>
+#include <coconuts/Renderer.h>
+#include <coconuts/graphics/RendererAPI.h>
+#include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
+
+// Platform - OpenGL
+#include "OpenGLSampler.h"
+
+namespace Coconuts
+{
+
+    //static
+    Sampler* Sampler::Create(const SamplerSpecification& spec)
+    {
+        switch(Renderer::GetRendererAPI())
+        {
+            case RendererAPI::API::OpenGL:
+            {
+                Sampler* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLSampler(spec); });
+                return ptr;
+
+                break;
+            }
+
+            default:
+            {
+                LOG_CRITICAL("Sampler - Unknown RendererAPI {}", Renderer::GetRendererAPI());
+                exit(1);
+            }
+        }
+
+        return nullptr;
+    }
+
+    //static
+    void Sampler::Unbind(uint32_t slot)
+    {
+        switch(Renderer::GetRendererAPI())
+        {
+            case RendererAPI::API::OpenGL:
+            {
+                OpenGLSampler::UnbindSlot(slot);
+                break;
+            }
+
+            default:
+            {
+                LOG_CRITICAL("Sampler - Unknown RendererAPI {}", Renderer::GetRendererAPI());
+                exit(1);
+            }
+        }
+    }
+
+}
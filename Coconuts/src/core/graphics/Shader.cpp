@@ -18,6 +18,7 @@
 #include <coconuts/Renderer.h>
 #include <coconuts/graphics/RendererAPI.h>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
 
 // Platform - OpenGL
 #include "OpenGLShader.h"
@@ -31,7 +32,9 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                return new OpenGLShader();
+                Shader* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLShader(); });
+                return ptr;
                 
                 break;
             }
@@ -54,7 +57,9 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                return new OpenGLShader(vertexShaderSrc, fragmentShaderSrc);
+                Shader* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLShader(vertexShaderSrc, fragmentShaderSrc); });
+                return ptr;
                 
                 break;
             }
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/SpriteAnimationClip.h>
+#include <coconuts/Logger.h>
+
+namespace Coconuts
+{
+    
+    SpriteAnimationClip::SpriteAnimationClip(const std::shared_ptr<Texture2D>& spriteSheet,
+                                             const std::vector<glm::vec2>& texCoords,
+                                             const FrameGrid& grid,
+                                             bool loop)
+        : m_Texture(spriteSheet),
+          m_TexCoords(texCoords),
+          m_FrameCount(texCoords.size() / 4),
+          m_Grid(grid),
+          m_FrameDuration((grid.framesPerSecond > 0.0f) ? (1.0f / grid.framesPerSecond) : 0.0f),
+          m_Loop(loop)
+    {
+    }
+    
+    // static
+    SpriteAnimationClip* SpriteAnimationClip::Create(const std::shared_ptr<Texture2D>& spriteSheet,
+                                                     const glm::vec2& firstCoords,
+                                                     const glm::vec2& cellSize,
+                                                     uint32_t frameCount,
+                                                     float framesPerSecond,
+                                                     bool loop,
+                                                     uint32_t framesPerRow,
+                                                     const glm::vec2& spriteSize)
+    {
+        if (spriteSheet == nullptr || frameCount == 0)
+        {
+            LOG_ERROR("SpriteAnimationClip - Invalid sprite sheet or empty clip");
+            return nullptr;
+        }
+        
+        float sheetWidth = (float) spriteSheet->GetWidth();
+        float sheetHeight = (float) spriteSheet->GetHeight();
+        
+        if (framesPerRow == 0)
+        {
+            /* Whole row, counting from the first frame */
+            framesPerRow = (uint32_t) ((sheetWidth / cellSize.x - firstCoords.x) / spriteSize.x);
+            framesPerRow = (framesPerRow == 0) ? 1 : framesPerRow;
+        }
+        
+        std::vector<glm::vec2> texCoords;
+        texCoords.reserve(frameCount * 4);
+        
+        for (uint32_t i = 0; i < frameCount; i++)
+        {
+            glm::vec2 coords = { firstCoords.x + (i % framesPerRow) * spriteSize.x,
+                                 firstCoords.y + (i / framesPerRow) * spriteSize.y };
+            
+            /* Same mapping as Sprite::Create */
+            glm::vec2 min = { (coords.x * cellSize.x) / sheetWidth,
+                              (coords.y * cellSize.y) / sheetHeight };
+            
+            glm::vec2 max = { ((coords.x + spriteSize.x) * cellSize.x) / sheetWidth,
+                              ((coords.y + spriteSize.y) * cellSize.y) / sheetHeight };
+            
+            texCoords.push_back({min.x, min.y});
+            texCoords.push_back({max.x, min.y});
+            texCoords.push_back({max.x, max.y});
+            texCoords.push_back({min.x, max.y});
+        }
+        
+        FrameGrid grid = { firstCoords, cellSize, spriteSize, framesPerRow, framesPerSecond };
+        return new SpriteAnimationClip(spriteSheet, texCoords, grid, loop);
+    }
+    
+}
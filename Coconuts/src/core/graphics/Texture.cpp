@@ -18,6 +18,7 @@
 #include <coconuts/Renderer.h>
 #include <coconuts/graphics/RendererAPI.h>
 #include <coconuts/Layer.h>
+#include <coconuts/graphics/RenderThread.h>
 
 // Platform - OpenGL
 #include "OpenGLTexture.h"
@@ -31,7 +32,8 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                Texture2D* ptr = new OpenGLTexture2D(width, height, data, size);
+                Texture2D* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLTexture2D(width, height, data, size); });
                 if (ptr->IsValid() == false)
                 {
                     delete ptr; // free
@@ -58,7 +60,64 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                Texture2D* ptr = new OpenGLTexture2D(path);
+                Texture2D* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLTexture2D(path); });
+                if (ptr->IsValid() == false)
+                {
+                    delete ptr; // free
+                    return nullptr;
+                }
+                return ptr; // ok
+                
+                break;
+            }
+            
+            default:
+            {
+                LOG_CRITICAL("Texture2D - Unknown RendererAPI {}", Renderer::GetRendererAPI());
+                exit(1);
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    Texture2D* Texture2D::Create(const std::string& path, const void* encoded, uint64_t size)
+    {
+        switch(Renderer::GetRendererAPI())
+        {
+            case RendererAPI::API::OpenGL:
+            {
+                Texture2D* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLTexture2D(path, encoded, size); });
+                if (ptr->IsValid() == false)
+                {
+                    delete ptr; // free
+                    return nullptr;
+                }
+                return ptr; // ok
+                
+                break;
+            }
+            
+            default:
+            {
+                LOG_CRITICAL("Texture2D - Unknown RendererAPI {}", Renderer::GetRendererAPI());
+                exit(1);
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    Texture2D* Texture2D::Create(const std::string& path, uint32_t width, uint32_t height, uint32_t channels, const void* pixels)
+    {
+        switch(Renderer::GetRendererAPI())
+        {
+            case RendererAPI::API::OpenGL:
+            {
+                Texture2D* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLTexture2D(path, width, height, channels, pixels); });
                 if (ptr->IsValid() == false)
                 {
                     delete ptr; // free
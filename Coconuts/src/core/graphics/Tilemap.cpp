@@ -0,0 +1,237 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/graphics/Tilemap.h>
+#include <coconuts/graphics/Renderer2D.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace Coconuts
+{
+    
+    Tilemap::Tilemap(uint32_t width, uint32_t height, const glm::vec2& tileSize)
+        : m_Width(width),
+          m_Height(height),
+          m_TileSize(tileSize),
+          m_TintColor(glm::vec4(1.0f)),
+          m_Tiles(width * height, EMPTY_TILE),
+          m_CellSize(glm::vec2(0.0f)),
+          m_ChunksX((width + CHUNK_TILES - 1) / CHUNK_TILES),
+          m_ChunksY((height + CHUNK_TILES - 1) / CHUNK_TILES),
+          m_Chunks(m_ChunksX * m_ChunksY),
+          m_BuiltOrigin(glm::vec2(0.0f))
+    {
+    }
+    
+    void Tilemap::SetTileset(const std::shared_ptr<Texture2D>& tileset, const glm::vec2& cellSize)
+    {
+        m_Tileset = tileset;
+        m_CellSize = cellSize;
+        MarkAllDirty();
+    }
+    
+    void Tilemap::SetTile(uint32_t x, uint32_t y, uint16_t tile)
+    {
+        if (x >= m_Width || y >= m_Height)
+        {
+            LOG_WARN("Tilemap - Tile ({}, {}) out of bounds", x, y);
+            return;
+        }
+        
+        uint16_t& current = m_Tiles[y * m_Width + x];
+        if (current != tile)
+        {
+            current = tile;
+            m_Chunks[(y / CHUNK_TILES) * m_ChunksX + (x / CHUNK_TILES)].dirty = true;
+        }
+    }
+    
+    uint16_t Tilemap::GetTile(uint32_t x, uint32_t y) const
+    {
+        if (x >= m_Width || y >= m_Height)
+        {
+            return EMPTY_TILE;
+        }
+        
+        return m_Tiles[y * m_Width + x];
+    }
+    
+    bool Tilemap::SetTiles(const std::vector<uint16_t>& tiles)
+    {
+        if (tiles.size() != m_Tiles.size())
+        {
+            LOG_ERROR("Tilemap - Expected {} tiles, got {}", m_Tiles.size(), tiles.size());
+            return false;
+        }
+        
+        m_Tiles = tiles;
+        MarkAllDirty();
+        return true;
+    }
+    
+    void Tilemap::SetTileSize(const glm::vec2& tileSize)
+    {
+        m_TileSize = tileSize;
+        MarkAllDirty();
+    }
+    
+    void Tilemap::SetTintColor(const glm::vec4& tintColor)
+    {
+        m_TintColor = tintColor;
+        MarkAllDirty();
+    }
+    
+    void Tilemap::Draw(const glm::vec2& origin,
+                       const glm::mat4& viewProj,
+                       const std::shared_ptr<Sampler>& sampler)
+    {
+        if (m_Tileset == nullptr || m_Chunks.empty())
+        {
+            return;
+        }
+        
+        /* Positions are baked in world space: moving the map rebuilds it */
+        if (origin != m_BuiltOrigin)
+        {
+            m_BuiltOrigin = origin;
+            MarkAllDirty();
+        }
+        
+        /* World space bounds of the view (NDC corners back through viewProj) */
+        glm::mat4 inverse = glm::inverse(viewProj);
+        glm::vec2 viewMin(  std::numeric_limits<float>::max() );
+        glm::vec2 viewMax( -std::numeric_limits<float>::max() );
+        
+        const glm::vec4 corners[4] = { {-1.0f, -1.0f, 0.0f, 1.0f}, { 1.0f, -1.0f, 0.0f, 1.0f},
+                                       { 1.0f,  1.0f, 0.0f, 1.0f}, {-1.0f,  1.0f, 0.0f, 1.0f} };
+        for (const glm::vec4& corner : corners)
+        {
+            glm::vec4 world = inverse * corner;
+            viewMin = glm::min(viewMin, glm::vec2(world) / world.w);
+            viewMax = glm::max(viewMax, glm::vec2(world) / world.w);
+        }
+        
+        /* Visible chunk range */
+        glm::vec2 chunkSize = m_TileSize * (float) CHUNK_TILES;
+        int32_t firstX = (int32_t) std::floor((viewMin.x - origin.x) / chunkSize.x);
+        int32_t firstY = (int32_t) std::floor((viewMin.y - origin.y) / chunkSize.y);
+        int32_t lastX  = (int32_t) std::floor((viewMax.x - origin.x) / chunkSize.x);
+        int32_t lastY  = (int32_t) std::floor((viewMax.y - origin.y) / chunkSize.y);
+        
+        firstX = std::max(firstX, 0);
+        firstY = std::max(firstY, 0);
+        lastX  = std::min(lastX, (int32_t) m_ChunksX - 1);
+        lastY  = std::min(lastY, (int32_t) m_ChunksY - 1);
+        
+        for (int32_t cy = firstY; cy <= lastY; cy++)
+        {
+            for (int32_t cx = firstX; cx <= lastX; cx++)
+            {
+                Chunk& chunk = m_Chunks[cy * m_ChunksX + cx];
+                
+                if (chunk.dirty)
+                {
+                    BuildChunk(cx, cy);
+                }
+                
+                Renderer2D::DrawCachedQuads(chunk.vertexArray, chunk.quadCount, m_Tileset, sampler);
+            }
+        }
+    }
+    
+    void Tilemap::BuildChunk(uint32_t chunkX, uint32_t chunkY)
+    {
+        Chunk& chunk = m_Chunks[chunkY * m_ChunksX + chunkX];
+        chunk.dirty = false;
+        chunk.quadCount = 0;
+        
+        if (m_CellSize.x <= 0.0f || m_CellSize.y <= 0.0f)
+        {
+            return;
+        }
+        
+        float sheetWidth = (float) m_Tileset->GetWidth();
+        float sheetHeight = (float) m_Tileset->GetHeight();
+        uint32_t columns = (uint32_t) (sheetWidth / m_CellSize.x);
+        columns = (columns == 0) ? 1 : columns;
+        
+        const float texIndex = (float) BatchRender::cachedQuadsTextureSlot;
+        
+        uint32_t beginX = chunkX * CHUNK_TILES;
+        uint32_t beginY = chunkY * CHUNK_TILES;
+        uint32_t endX = std::min(beginX + CHUNK_TILES, m_Width);
+        uint32_t endY = std::min(beginY + CHUNK_TILES, m_Height);
+        
+        std::vector<QuadVertex> vertices;
+        vertices.reserve((endX - beginX) * (endY - beginY) * BatchRender::verticesPerQuad);
+        
+        for (uint32_t y = beginY; y < endY; y++)
+        {
+            for (uint32_t x = beginX; x < endX; x++)
+            {
+                uint16_t tile = m_Tiles[y * m_Width + x];
+                if (tile == EMPTY_TILE)
+                {
+                    continue;
+                }
+                
+                /* Texture coords (same mapping as Sprite::Create) */
+                glm::vec2 coords = { (float) (tile % columns), (float) (tile / columns) };
+                glm::vec2 uvMin = { (coords.x * m_CellSize.x) / sheetWidth,
+                                    (coords.y * m_CellSize.y) / sheetHeight };
+                glm::vec2 uvMax = { ((coords.x + 1.0f) * m_CellSize.x) / sheetWidth,
+                                    ((coords.y + 1.0f) * m_CellSize.y) / sheetHeight };
+                
+                glm::vec2 min = m_BuiltOrigin + glm::vec2((float) x, (float) y) * m_TileSize;
+                glm::vec2 max = min + m_TileSize;
+                
+                vertices.push_back({ {min.x, min.y, 0.0f}, m_TintColor, {uvMin.x, uvMin.y}, texIndex, 1.0f });
+                vertices.push_back({ {max.x, min.y, 0.0f}, m_TintColor, {uvMax.x, uvMin.y}, texIndex, 1.0f });
+                vertices.push_back({ {max.x, max.y, 0.0f}, m_TintColor, {uvMax.x, uvMax.y}, texIndex, 1.0f });
+                vertices.push_back({ {min.x, max.y, 0.0f}, m_TintColor, {uvMin.x, uvMax.y}, texIndex, 1.0f });
+            }
+        }
+        
+        chunk.quadCount = vertices.size() / BatchRender::verticesPerQuad;
+        
+        if (chunk.quadCount == 0)
+        {
+            chunk.vertexArray.reset();
+            chunk.vertexBuffer.reset();
+            return;
+        }
+        
+        /* Static buffer sized to this chunk's tiles */
+        chunk.vertexArray.reset( VertexArray::Create() );
+        chunk.vertexBuffer.reset( VertexBuffer::Create((float*) vertices.data(), vertices.size() * sizeof(QuadVertex)) );
+        chunk.vertexBuffer->SetLayout(Renderer2D::GetQuadVertexLayout());
+        
+        std::shared_ptr<IndexBuffer> indexBuffer = Renderer2D::GetQuadIndexBuffer();
+        chunk.vertexArray->AddVertexBuffer(chunk.vertexBuffer);
+        chunk.vertexArray->SetIndexBuffer(indexBuffer);
+    }
+    
+    void Tilemap::MarkAllDirty()
+    {
+        for (Chunk& chunk : m_Chunks)
+        {
+            chunk.dirty = true;
+        }
+    }
+    
+}
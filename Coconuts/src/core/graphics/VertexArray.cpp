@@ -18,6 +18,7 @@
 #include <coconuts/Renderer.h>
 #include <coconuts/graphics/RendererAPI.h>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
 
 // Platform - OpenGL
 #include "OpenGLVertexArray.h"
@@ -32,7 +33,9 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                return new OpenGLVertexArray();
+                VertexArray* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLVertexArray(); });
+                return ptr;
                 
                 break;
             }
@@ -18,6 +18,7 @@
 #include <coconuts/Renderer.h>
 #include <coconuts/graphics/RendererAPI.h>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
 
 // Platform - OpenGL
 #include "OpenGLVertexBuffer.h"
@@ -33,7 +34,9 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                return new OpenGLVertexBuffer(size);
+                VertexBuffer* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLVertexBuffer(size); });
+                return ptr;
                 
                 break;
             }
@@ -55,7 +58,9 @@ namespace Coconuts
         {
             case RendererAPI::API::OpenGL:
             {
-                return new OpenGLVertexBuffer(vertices, size);
+                VertexBuffer* ptr = nullptr;
+                RenderThread::Sync([&] { ptr = new OpenGLVertexBuffer(vertices, size); });
+                return ptr;
                 
                 break;
             }
@@ -0,0 +1,316 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/input/InputRecorder.h>
+#include <coconuts/Logger.h>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    namespace
+    {
+        constexpr char     TAPE_MAGIC[8]   = { 'C', 'C', 'N', 'I', 'N', 'P', 'U', 'T' };
+        constexpr uint32_t TAPE_VERSION    = 2;   /* 2: frame timestep */
+        constexpr uint32_t KEY_BYTES       = (InputState::KEY_COUNT + 7) / 8;
+        constexpr uint32_t BUTTON_BYTES    = (InputState::BUTTON_COUNT + 7) / 8;
+        
+        struct Frame
+        {
+            InputState  state;
+            float       seconds;    /* frame timestep */
+        };
+        
+        struct Tape
+        {
+            std::vector<Frame>      frames;
+            size_t                  next        = 0;
+            bool                    recording   = false;
+            bool                    replaying   = false;
+            bool                    loop        = false;
+        };
+        
+        Tape& GetTape()
+        {
+            static Tape s_Tape;
+            return s_Tape;
+        }
+        
+        template <size_t N>
+        void PackBits(const std::bitset<N>& bits, uint8_t* bytes)
+        {
+            std::memset(bytes, 0, (N + 7) / 8);
+            for (size_t i = 0; i < N; i++)
+            {
+                if (bits.test(i))
+                {
+                    bytes[i / 8] |= (uint8_t) (1 << (i % 8));
+                }
+            }
+        }
+        
+        template <size_t N>
+        void UnpackBits(const uint8_t* bytes, std::bitset<N>& bits)
+        {
+            for (size_t i = 0; i < N; i++)
+            {
+                bits.set(i, (bytes[i / 8] >> (i % 8)) & 1);
+            }
+        }
+        
+        /* Tape file: magic, version, key / button counts, frame count, frames (keys, buttons, mouse, timestep) */
+        struct TapeHeader
+        {
+            char        magic[8];
+            uint32_t    version;
+            uint32_t    keyCount;
+            uint32_t    buttonCount;
+            uint32_t    reserved;
+            uint64_t    frameCount;
+        };
+    }
+    
+    
+    //static
+    void InputRecorder::StartRecording()
+    {
+        Tape& tape = GetTape();
+        
+        if (tape.replaying)
+        {
+            LOG_WARN("InputRecorder - Can't record while replaying");
+            return;
+        }
+        
+        tape.frames.clear();
+        tape.recording = true;
+        LOG_DEBUG("InputRecorder - Recording");
+    }
+    
+    //static
+    void InputRecorder::StopRecording()
+    {
+        Tape& tape = GetTape();
+        
+        if (tape.recording)
+        {
+            tape.recording = false;
+            LOG_DEBUG("InputRecorder - Recorded {} frames", tape.frames.size());
+        }
+    }
+    
+    //static
+    bool InputRecorder::IsRecording()
+    {
+        return GetTape().recording;
+    }
+    
+    //static
+    bool InputRecorder::StartReplay(bool loop)
+    {
+        Tape& tape = GetTape();
+        
+        if (tape.frames.empty())
+        {
+            LOG_WARN("InputRecorder - Nothing to replay");
+            return false;
+        }
+        
+        StopRecording();
+        tape.next = 0;
+        tape.loop = loop;
+        tape.replaying = true;
+        LOG_DEBUG("InputRecorder - Replaying {} frames", tape.frames.size());
+        return true;
+    }
+    
+    //static
+    void InputRecorder::StopReplay()
+    {
+        GetTape().replaying = false;
+    }
+    
+    //static
+    bool InputRecorder::IsReplaying()
+    {
+        return GetTape().replaying;
+    }
+    
+    //static
+    size_t InputRecorder::GetFrameCount()
+    {
+        return GetTape().frames.size();
+    }
+    
+    //static
+    void InputRecorder::Clear()
+    {
+        Tape& tape = GetTape();
+        tape.frames.clear();
+        tape.recording = false;
+        tape.replaying = false;
+    }
+    
+    //static
+    bool InputRecorder::NextFrame(InputState& state, float& frameSeconds)
+    {
+        Tape& tape = GetTape();
+        
+        if (!tape.replaying)
+        {
+            return false;
+        }
+        
+        if (tape.next == tape.frames.size())
+        {
+            if (!tape.loop)
+            {
+                tape.replaying = false;
+                LOG_DEBUG("InputRecorder - Replay finished");
+                return false;
+            }
+            
+            tape.next = 0;
+        }
+        
+        const Frame& frame = tape.frames[tape.next++];
+        state = frame.state;
+        frameSeconds = frame.seconds;
+        return true;
+    }
+    
+    //static
+    void InputRecorder::Record(const InputState& state, float frameSeconds)
+    {
+        Tape& tape = GetTape();
+        
+        if (tape.recording)
+        {
+            tape.frames.push_back({ state, frameSeconds });
+        }
+    }
+    
+    //static
+    bool InputRecorder::Save(const std::string& filepath)
+    {
+        std::ofstream file(filepath, std::ios::binary);
+        
+        if (!file.is_open())
+        {
+            LOG_ERROR("InputRecorder - Could not open {} for writing", filepath);
+            return false;
+        }
+        
+        const Tape& tape = GetTape();
+        
+        TapeHeader header;
+        std::memcpy(header.magic, TAPE_MAGIC, sizeof(header.magic));
+        header.version = TAPE_VERSION;
+        header.keyCount = InputState::KEY_COUNT;
+        header.buttonCount = InputState::BUTTON_COUNT;
+        header.reserved = 0;
+        header.frameCount = tape.frames.size();
+        file.write((const char*) &header, sizeof(header));
+        
+        uint8_t keys[KEY_BYTES];
+        uint8_t buttons[BUTTON_BYTES];
+        
+        for (const Frame& frame : tape.frames)
+        {
+            PackBits(frame.state.keys, keys);
+            PackBits(frame.state.buttons, buttons);
+            file.write((const char*) keys, sizeof(keys));
+            file.write((const char*) buttons, sizeof(buttons));
+            file.write((const char*) &frame.state.mouseX, sizeof(frame.state.mouseX));
+            file.write((const char*) &frame.state.mouseY, sizeof(frame.state.mouseY));
+            file.write((const char*) &frame.seconds, sizeof(frame.seconds));
+        }
+        
+        if (!file.good())
+        {
+            LOG_ERROR("InputRecorder - Failed to write {}", filepath);
+            return false;
+        }
+        
+        LOG_DEBUG("InputRecorder - {} frames saved to {}", tape.frames.size(), filepath);
+        return true;
+    }
+    
+    //static
+    bool InputRecorder::Load(const std::string& filepath)
+    {
+        std::ifstream file(filepath, std::ios::binary);
+        
+        if (!file.is_open())
+        {
+            LOG_ERROR("InputRecorder - Could not open {}", filepath);
+            return false;
+        }
+        
+        TapeHeader header;
+        file.read((char*) &header, sizeof(header));
+        
+        if (!file.good() || std::memcmp(header.magic, TAPE_MAGIC, sizeof(header.magic)) != 0)
+        {
+            LOG_ERROR("InputRecorder - {} is not an input tape", filepath);
+            return false;
+        }
+        
+        if (header.version != TAPE_VERSION ||
+            header.keyCount != InputState::KEY_COUNT ||
+            header.buttonCount != InputState::BUTTON_COUNT)
+        {
+            LOG_ERROR("InputRecorder - {}: unsupported tape (version {}, {} keys, {} buttons)",
+                      filepath, header.version, header.keyCount, header.buttonCount);
+            return false;
+        }
+        
+        std::vector<Frame> frames;
+        uint8_t keys[KEY_BYTES];
+        uint8_t buttons[BUTTON_BYTES];
+        
+        for (uint64_t i = 0; i < header.frameCount; i++)
+        {
+            Frame frame;
+            file.read((char*) keys, sizeof(keys));
+            file.read((char*) buttons, sizeof(buttons));
+            file.read((char*) &frame.state.mouseX, sizeof(frame.state.mouseX));
+            file.read((char*) &frame.state.mouseY, sizeof(frame.state.mouseY));
+            file.read((char*) &frame.seconds, sizeof(frame.seconds));
+            
+            if (!file.good())
+            {
+                LOG_ERROR("InputRecorder - {} is truncated ({} of {} frames)", filepath, i, header.frameCount);
+                return false;
+            }
+            
+            UnpackBits(keys, frame.state.keys);
+            UnpackBits(buttons, frame.state.buttons);
+            frames.push_back(frame);
+        }
+        
+        Tape& tape = GetTape();
+        tape.frames.swap(frames);
+        tape.recording = false;
+        tape.replaying = false;
+        
+        LOG_DEBUG("InputRecorder - {} frames loaded from {}", tape.frames.size(), filepath);
+        return true;
+    }
+    
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/input/InputSnapshot.h>
+
+namespace Coconuts
+{
+    
+    void InputSnapshot::Advance(const InputState& next)
+    {
+        if (!held)
+        {
+            Consume();
+        }
+        
+        keysPressed |= next.keys & ~state.keys;
+        keysReleased |= state.keys & ~next.keys;
+        buttonsPressed |= next.buttons & ~state.buttons;
+        buttonsReleased |= state.buttons & ~next.buttons;
+        
+        /* First frame: no previous position */
+        deltaX += (frame == 0) ? 0.0 : next.mouseX - state.mouseX;
+        deltaY += (frame == 0) ? 0.0 : next.mouseY - state.mouseY;
+        
+        state = next;
+        held = false;
+        frame++;
+    }
+    
+    void InputSnapshot::Consume()
+    {
+        keysPressed.reset();
+        keysReleased.reset();
+        buttonsPressed.reset();
+        buttonsReleased.reset();
+        deltaX = 0.0;
+        deltaY = 0.0;
+    }
+    
+}
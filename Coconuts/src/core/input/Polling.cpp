@@ -0,0 +1,40 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/Polling.h>
+#include <coconuts/input/InputRecorder.h>
+
+namespace Coconuts
+{
+    
+    InputSnapshot Polling::s_Snapshot;
+    
+    //static
+    void Polling::Capture(float& frameSeconds)
+    {
+        InputState state;
+        
+        /* Replay: the tape's frame time stands in for the clock's */
+        if (!InputRecorder::NextFrame(state, frameSeconds))
+        {
+            s_Instance->CaptureImpl(state);
+        }
+        
+        InputRecorder::Record(state, frameSeconds);
+        s_Snapshot.Advance(state);
+    }
+    
+}
@@ -0,0 +1,398 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/jobs/JobSystem.h>
+#include <coconuts/debug/Profiler.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <thread>
+
+namespace Coconuts
+{
+    
+    struct JobSystem::Job
+    {
+        JobFunction     function;
+        JobCounter*     counter;
+        const char*     name;
+    };
+    
+    /* Jobs by value: no allocation per push (the deque grows in blocks) */
+    struct WorkQueue
+    {
+        std::mutex                  guard;
+        std::deque<JobSystem::Job>  jobs;
+    };
+    
+    namespace
+    {
+        struct JobSystemState
+        {
+            std::vector<std::thread>        workers;
+            std::unique_ptr<WorkQueue[]>    queues;     /* [0] main thread, [1..N] workers */
+            uint32_t                        queueCount = 0;
+            
+            std::atomic<bool>               running {false};
+            std::atomic<uint32_t>           queued {0};
+            
+            /* Idle workers sleep here */
+            std::mutex                      sleepGuard;
+            std::condition_variable         wake;
+        };
+        
+        JobSystemState s_State;
+        
+        thread_local uint32_t t_ThreadIndex = 0;
+        thread_local uint32_t t_StealSeed = 0x9E3779B9u;
+        
+        inline uint32_t NextVictim()
+        {
+            /* xorshift: spread thieves over the other queues */
+            t_StealSeed ^= t_StealSeed << 13;
+            t_StealSeed ^= t_StealSeed >> 17;
+            t_StealSeed ^= t_StealSeed << 5;
+            return t_StealSeed % s_State.queueCount;
+        }
+    }
+    
+    
+    //static
+    void JobSystem::Init(uint32_t workerCount)
+    {
+        if (s_State.running)
+        {
+            LOG_WARN("JobSystem - Already initialized");
+            return;
+        }
+        
+        if (workerCount == 0)
+        {
+            uint32_t hardware = std::thread::hardware_concurrency();
+            workerCount = (hardware > 1) ? hardware - 1 : 1;
+        }
+        
+        s_State.queueCount = workerCount + 1;
+        s_State.queues.reset(new WorkQueue[s_State.queueCount]);
+        s_State.queued = 0;
+        s_State.running = true;
+        
+        t_ThreadIndex = 0;
+        Profiler::SetThreadIndex(0);
+        
+        s_State.workers.reserve(workerCount);
+        for (uint32_t i = 1; i <= workerCount; i++)
+        {
+            s_State.workers.emplace_back(&JobSystem::WorkerLoop, i);
+        }
+        
+        LOG_DEBUG("JobSystem - {} worker threads", workerCount);
+    }
+    
+    //static
+    void JobSystem::Shutdown()
+    {
+        if (!s_State.running)
+        {
+            return;
+        }
+        
+        /* Drain what's left from here */
+        for (uint32_t i = 0; i < s_State.queueCount; i++)
+        {
+            Job job;
+            while (Pop(job))
+            {
+                Execute(job);
+            }
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(s_State.sleepGuard);
+            s_State.running = false;
+        }
+        s_State.wake.notify_all();
+        
+        for (std::thread& worker : s_State.workers)
+        {
+            worker.join();
+        }
+        
+        s_State.workers.clear();
+        s_State.queues.reset();
+        s_State.queueCount = 0;
+        
+        LOG_DEBUG("JobSystem - Shutdown");
+    }
+    
+    //static
+    bool JobSystem::IsInitialized()
+    {
+        return s_State.running;
+    }
+    
+    //static
+    uint32_t JobSystem::GetWorkerCount()
+    {
+        return s_State.queueCount ? s_State.queueCount - 1 : 0;
+    }
+    
+    //static
+    uint32_t JobSystem::GetThreadIndex()
+    {
+        return t_ThreadIndex;
+    }
+    
+    //static
+    void JobSystem::Schedule(const JobFunction& job, JobCounter* counter, JobCounter* dependency, const char* name)
+    {
+        if (counter != nullptr)
+        {
+            counter->m_Pending.fetch_add(1, std::memory_order_acq_rel);
+        }
+        
+        /* Park it on its dependency; Complete() releases it */
+        if (dependency != nullptr && !dependency->IsDone())
+        {
+            std::lock_guard<std::mutex> lock(dependency->m_Guard);
+            
+            if (!dependency->IsDone())
+            {
+                dependency->m_Continuations.push_back({ job, counter, name });
+                return;
+            }
+        }
+        
+        Push({ job, counter, name });
+    }
+    
+    //static
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        while (!counter.IsDone())
+        {
+            if (!RunOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+        
+        /* Let the last Complete() on counter leave its guard */
+        std::lock_guard<std::mutex> lock(counter.m_Guard);
+    }
+    
+    //static
+    bool JobSystem::RunOne()
+    {
+        Job job;
+        if (!Pop(job))
+        {
+            return false;
+        }
+        
+        Execute(job);
+        return true;
+    }
+    
+    //static
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize,
+                                const std::function<void(uint32_t, uint32_t)>& fn,
+                                const char* name)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        
+        if (grainSize == 0)
+        {
+            /* A few ranges per thread, so stealing can even out uneven ranges */
+            grainSize = std::max(1u, count / ((GetWorkerCount() + 1) * 4));
+        }
+        
+        if (!s_State.running || count <= grainSize)
+        {
+            fn(0, count);
+            return;
+        }
+        
+        /* The whole batch, once (jobs themselves aren't profiled) */
+        __CCNCORE_PROFILER_SCOPE__ (name)
+        
+        JobCounter counter;
+        for (uint32_t begin = grainSize; begin < count; begin += grainSize)
+        {
+            uint32_t end = std::min(begin + grainSize, count);
+            Schedule([&fn, begin, end] { fn(begin, end); }, &counter, nullptr, name);
+        }
+        
+        /* Caller takes the first range, then helps with the rest */
+        fn(0, grainSize);
+        
+        Wait(counter);
+    }
+    
+    //static
+    void JobSystem::Push(Job&& job)
+    {
+        if (!s_State.running)
+        {
+            Execute(job);
+            return;
+        }
+        
+        /* Own queue; threads that aren't workers share the main thread's */
+        uint32_t index = (t_ThreadIndex < s_State.queueCount) ? t_ThreadIndex : 0;
+        WorkQueue& queue = s_State.queues[index];
+        {
+            std::lock_guard<std::mutex> lock(queue.guard);
+            queue.jobs.push_back(std::move(job));
+        }
+        
+        s_State.queued.fetch_add(1, std::memory_order_release);
+        {
+            /* Pairs with the sleeping worker's predicate check (no lost wake up) */
+            std::lock_guard<std::mutex> lock(s_State.sleepGuard);
+        }
+        s_State.wake.notify_one();
+    }
+    
+    //static
+    bool JobSystem::Pop(Job& job)
+    {
+        if (s_State.queueCount == 0 || s_State.queued.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+        
+        uint32_t own = (t_ThreadIndex < s_State.queueCount) ? t_ThreadIndex : 0;
+        
+        /* (1) Newest job of our own queue */
+        {
+            WorkQueue& queue = s_State.queues[own];
+            std::lock_guard<std::mutex> lock(queue.guard);
+            
+            if (!queue.jobs.empty())
+            {
+                job = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+                s_State.queued.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        
+        /* (2) Steal the oldest job of someone else */
+        uint32_t start = NextVictim();
+        for (uint32_t i = 0; i < s_State.queueCount; i++)
+        {
+            uint32_t victim = (start + i) % s_State.queueCount;
+            if (victim == own)
+            {
+                continue;
+            }
+            
+            WorkQueue& queue = s_State.queues[victim];
+            std::lock_guard<std::mutex> lock(queue.guard);
+            
+            if (!queue.jobs.empty())
+            {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+                s_State.queued.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    
+    //static
+    void JobSystem::Execute(Job& job)
+    {
+        /**
+         * Not profiled per job: TimeProfiler serializes every thread on one
+         * lock. Batches are profiled once by whoever waits on them.
+         */
+        job.function();
+        
+        if (job.counter != nullptr)
+        {
+            Complete(job.counter);
+        }
+    }
+    
+    //static
+    void JobSystem::Complete(JobCounter* counter)
+    {
+        /* Not the last one: counter is left alone right after the decrement */
+        uint32_t pending = counter->m_Pending.load(std::memory_order_acquire);
+        while (pending > 1)
+        {
+            if (counter->m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+            {
+                return;
+            }
+        }
+        
+        /**
+         * Last one out releases whatever depended on this counter.
+         * Done under the guard: Wait() takes it before returning, so the
+         * counter can't go out of scope while we still touch it.
+         */
+        std::vector<JobCounter::Continuation> ready;
+        {
+            std::lock_guard<std::mutex> lock(counter->m_Guard);
+            if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                ready.swap(counter->m_Continuations);
+            }
+        }
+        
+        for (JobCounter::Continuation& continuation : ready)
+        {
+            Push({ std::move(continuation.function), continuation.counter, continuation.name });
+        }
+    }
+    
+    //static
+    void JobSystem::WorkerLoop(uint32_t index)
+    {
+        t_ThreadIndex = index;
+        t_StealSeed ^= index * 0x85EBCA6Bu;
+        Profiler::SetThreadIndex(index);
+        
+        while (true)
+        {
+            Job job;
+            if (Pop(job))
+            {
+                Execute(job);
+                continue;
+            }
+            
+            std::unique_lock<std::mutex> lock(s_State.sleepGuard);
+            s_State.wake.wait(lock, [] { return s_State.queued.load(std::memory_order_acquire) > 0 || !s_State.running; });
+            
+            if (!s_State.running && s_State.queued == 0)
+            {
+                break;
+            }
+        }
+    }
+    
+}
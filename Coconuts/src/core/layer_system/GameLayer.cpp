@@ -41,6 +41,9 @@ namespace Coconuts
     }
     
     GameLayer::GameLayer()
+    :   m_EditedScene(nullptr),
+        m_PlayingScene(),
+        m_PlayingSceneID(0)
     {
     }
 
@@ -66,16 +69,41 @@ namespace Coconuts
         SceneManager::GetInstance().GetActiveScene()->OnChangeViewport(x, y);
     }
     
+    std::shared_ptr<Scene> GameLayer::GetActiveScene() const
+    {
+        return SceneManager::GetInstance().GetActiveScene();
+    }
+    
     bool GameLayer::IsActiveSceneUpdated()
     {
         return SceneManager::GetInstance().GetActiveScene()->IsUpdated();
     }
     
+    uint64_t GameLayer::GetActiveSceneStructureVersion() const
+    {
+        return SceneManager::GetInstance().GetActiveScene()->GetChangeTracker().GetStructureVersion();
+    }
+    
     std::vector<Entity> GameLayer::GetActiveSceneEntities() const
     {
         return SceneManager::GetInstance().GetActiveScene()->GetAllEntities();
     }
     
+    EntityList& GameLayer::GetActiveSceneEntityList() const
+    {
+        return SceneManager::GetInstance().GetActiveScene()->GetEntityList();
+    }
+    
+    ChangeTracker& GameLayer::GetActiveSceneChangeTracker() const
+    {
+        return SceneManager::GetInstance().GetActiveScene()->GetChangeTracker();
+    }
+    
+    Entity GameLayer::GetActiveSceneEntity(uint64_t id) const
+    {
+        return SceneManager::GetInstance().GetActiveScene()->GetEntity(id);
+    }
+    
     bool GameLayer::NewEntity()
     {
         /* Create on active scene */
@@ -93,4 +121,43 @@ namespace Coconuts
         return SceneManager::GetInstance().GetActiveScene()->GetAspectRatio();
     }
     
+    bool GameLayer::BeginPlay()
+    {
+        if (IsPlaying())
+        {
+            return false;
+        }
+        
+        std::shared_ptr<Scene> edited = SceneManager::GetInstance().GetActiveScene();
+        std::shared_ptr<Scene> playing = edited->Clone();
+        
+        m_PlayingSceneID = edited->GetID();
+        m_PlayingScene = playing;
+        m_EditedScene = SceneManager::GetInstance().ReplaceScene(m_PlayingSceneID, playing);
+        
+        LOG_INFO("Play Scene {} ({})", edited->GetName(), m_PlayingSceneID);
+        return m_EditedScene != nullptr;
+    }
+    
+    bool GameLayer::EndPlay()
+    {
+        if (!IsPlaying())
+        {
+            return false;
+        }
+        
+        /* Unless the clone was replaced meanwhile (e.g. another project loaded) */
+        std::shared_ptr<Scene> playing = m_PlayingScene.lock();
+        if (playing && SceneManager::GetInstance().GetScene(m_PlayingSceneID) == playing)
+        {
+            SceneManager::GetInstance().ReplaceScene(m_PlayingSceneID, m_EditedScene);
+        }
+        
+        m_EditedScene = nullptr;
+        m_PlayingScene.reset();
+        
+        LOG_INFO("Stopped Scene {}", m_PlayingSceneID);
+        return true;
+    }
+    
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 
 #include "GNUPolling.h"
 #include <coconuts/Application.h>
+#include <coconuts/Keyboard.h>
 #include <GLFW/glfw3.h>
 
 namespace Coconuts
@@ -23,45 +24,24 @@ namespace Coconuts
     /* Singleton instance */
     Polling* Polling::s_Instance = new GNUPolling();
     
-    /* Key */
-    bool GNUPolling::IsKeyPressedImpl(int keyCode)
+    void GNUPolling::CaptureImpl(InputState& state)
     {
         auto glfwWindow = static_cast<GLFWwindow*>
                 (Application::GetInstance().GetWindow().GetNativeWindow());
         
-        auto state = glfwGetKey(glfwWindow, keyCode);
+        /* Key (GLFW codes start at KEY_SPACE) */
+        for (int key = Keyboard::KEY_SPACE; key < (int) InputState::KEY_COUNT; key++)
+        {
+            auto keyState = glfwGetKey(glfwWindow, key);
+            state.keys.set(key, keyState == GLFW_PRESS || keyState == GLFW_REPEAT);
+        }
         
-        return (state == GLFW_PRESS || state == GLFW_REPEAT);
-    }
-    
-    /* Mouse */
-    bool GNUPolling::IsMouseButtonPressedImpl(int keyCode)
-    {
-        auto glfwWindow = static_cast<GLFWwindow*>
-                (Application::GetInstance().GetWindow().GetNativeWindow());
-        
-        auto state = glfwGetMouseButton(glfwWindow, keyCode);
-        
-        return (state == GLFW_PRESS);
-    }
-    
-    double GNUPolling::GetMouseXImpl()
-    {
-        auto glfwWindow = static_cast<GLFWwindow*>
-                (Application::GetInstance().GetWindow().GetNativeWindow());
-        
-        double xPos, yPos;
-        glfwGetCursorPos(glfwWindow, &xPos, &yPos);
-        return xPos;
-    }
-    
-    double GNUPolling::GetMouseYImpl()
-    {
-        auto glfwWindow = static_cast<GLFWwindow*>
-                (Application::GetInstance().GetWindow().GetNativeWindow());
+        /* Mouse */
+        for (int button = 0; button < (int) InputState::BUTTON_COUNT; button++)
+        {
+            state.buttons.set(button, glfwGetMouseButton(glfwWindow, button) == GLFW_PRESS);
+        }
         
-        double xPos, yPos;
-        glfwGetCursorPos(glfwWindow,  &xPos, &yPos);
-        return yPos;
+        glfwGetCursorPos(glfwWindow, &state.mouseX, &state.mouseY);
     }
 }
@@ -23,13 +23,7 @@ namespace Coconuts
     class GNUPolling : public Polling
     {
     protected:
-        /* Key */
-        bool IsKeyPressedImpl(int keyCode) override;
-        
-        /* Mouse */
-        bool IsMouseButtonPressedImpl(int keyCode) override;
-        double GetMouseXImpl() override;
-        double GetMouseYImpl() override;
+        void CaptureImpl(InputState& state) override;
     };
 }
 
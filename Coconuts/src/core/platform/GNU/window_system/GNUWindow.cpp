@@ -17,6 +17,7 @@
 #include "GNUWindow.h"
 #include <coconuts/EventSystem.h>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
 #include <cstring>
 #include "OpenGLGraphicsContext.h"
 
@@ -110,8 +111,8 @@ namespace Coconuts
                 /* Create the associated Coconuts Event for this kind of event */
                 WindowEvent::WindowClose winCloseEvent;
             
-                /* Dispatch this event to the callback function associated with this window */
-                thisWinData.eventCallback(winCloseEvent);
+                /* Queue this event, dispatched with the rest of the frame's events */
+                thisWinData.eventQueue.Push(winCloseEvent);
             });
              LOG_TRACE("* <WindowCloseCallback>  initialized");
             
@@ -127,8 +128,8 @@ namespace Coconuts
                 /* Create the associated Coconuts Event for this kind of event */
                 WindowEvent::WindowResize winResizeEvent(width, height);
             
-                /* Dispatch this event to the callback function associated with this window */
-                thisWinData.eventCallback(winResizeEvent);
+                /* Queue this event, dispatched with the rest of the frame's events */
+                thisWinData.eventQueue.Push(winResizeEvent);
             });
             LOG_TRACE("* <WindowSizeCallback>   initialized");
             
@@ -146,8 +147,8 @@ namespace Coconuts
                 
                 WindowEvent::WindowMinimize winMinimizeEvent(isMinimized);
             
-                /* Dispatch this event to the callback function associated with this window */
-                thisWinData.eventCallback(winMinimizeEvent);
+                /* Queue this event, dispatched with the rest of the frame's events */
+                thisWinData.eventQueue.Push(winMinimizeEvent);
             });
             LOG_TRACE("* <WindowSizeCallback>   initialized");
             
@@ -161,21 +162,21 @@ namespace Coconuts
                     case GLFW_PRESS:
                     {
                         InputKeyEvent::KeyPress keyPress(key, 0);
-                        thisWinData.eventCallback(keyPress);
+                        thisWinData.eventQueue.Push(keyPress);
                         break;
                     }
                     
                     case GLFW_RELEASE:
                     {
                         InputKeyEvent::KeyRelease keyRelease(key);
-                        thisWinData.eventCallback(keyRelease);
+                        thisWinData.eventQueue.Push(keyRelease);
                         break;
                     }
                         
                     case GLFW_REPEAT:
                     {
                         InputKeyEvent::KeyPress keyPress(key, 1);
-                        thisWinData.eventCallback(keyPress);
+                        thisWinData.eventQueue.Push(keyPress);
                         break;
                     }
                 }
@@ -192,14 +193,14 @@ namespace Coconuts
                     case GLFW_PRESS:
                     {
                         InputMouseEvent::MouseButtonPress buttonPress(button);
-                        thisWinData.eventCallback(buttonPress);
+                        thisWinData.eventQueue.Push(buttonPress);
                         break;
                     }
                     
                     case GLFW_RELEASE:
                     {
                         InputMouseEvent::MouseButtonRelease buttonRelease(button);
-                        thisWinData.eventCallback(buttonRelease);
+                        thisWinData.eventQueue.Push(buttonRelease);
                         break;
                     }
                 }
@@ -211,7 +212,7 @@ namespace Coconuts
                 GNUWindowData &thisWinData = *((GNUWindowData*)glfwGetWindowUserPointer(window));
                 
                 InputMouseEvent::MouseCursorMove cursorMove(xpos, ypos);
-                thisWinData.eventCallback(cursorMove);
+                thisWinData.eventQueue.Push(cursorMove);
             });
             LOG_TRACE("* <CursorPosCallback>    initialized     [Input:    Mouse]");
             
@@ -220,7 +221,7 @@ namespace Coconuts
                 GNUWindowData &thisWinData = *((GNUWindowData*)glfwGetWindowUserPointer(window));
                 
                 InputMouseEvent::MouseScroll scroll(xoffset, yoffset);
-                thisWinData.eventCallback(scroll);
+                thisWinData.eventQueue.Push(scroll);
             });
             LOG_TRACE("* <ScrollCallback>       initialized     [Input:    Mouse]");
             
@@ -237,28 +238,89 @@ namespace Coconuts
     }
     
     void GNUWindow::OnUpdate()
+    {
+        SwapBuffers();
+        PollEvents();
+        DispatchEvents();
+    }
+    
+    void GNUWindow::SwapBuffers()
     {
         graphicsContext->SwapBuffers();
-        
-        /* Poll for and process events */
+    }
+    
+    void GNUWindow::PollEvents()
+    {
+        /* Poll for and process events (main thread only) */
         glfwPollEvents();
     }
     
+    void GNUWindow::DispatchEvents()
+    {
+        m_WindowData.eventQueue.Dispatch();
+    }
+    
+    void GNUWindow::AttachContext()
+    {
+        graphicsContext->MakeCurrent();
+    }
+    
+    void GNUWindow::DetachContext()
+    {
+        graphicsContext->Release();
+    }
+    
     void GNUWindow::SetVSync(bool enable)
     {
-        if (enable)
-        {
-            glfwSwapInterval(1);
-            LOG_DEBUG("VSync enabled");
-        }
-        
-        else    // disable 
+        SetVSyncMode(enable ? VSyncMode::On : VSyncMode::Off);
+    }
+    
+    void GNUWindow::SetVSyncMode(VSyncMode mode)
+    {
+        switch (mode)
         {
-            glfwSwapInterval(0);
-            LOG_DEBUG("VSync disabled");
+            case VSyncMode::On:
+            {
+                RenderThread::Submit([] { glfwSwapInterval(1); });
+                LOG_DEBUG("VSync enabled");
+                break;
+            }
+            
+            case VSyncMode::Adaptive:
+            {
+                /* Late swaps tear instead of waiting a whole extra refresh */
+                bool tearControl = false;
+                RenderThread::Sync([&tearControl]
+                {
+                    tearControl = glfwExtensionSupported("GLX_EXT_swap_control_tear") ||
+                                  glfwExtensionSupported("WGL_EXT_swap_control_tear");
+                });
+                
+                if (tearControl)
+                {
+                    RenderThread::Submit([] { glfwSwapInterval(-1); });
+                    LOG_DEBUG("Adaptive VSync enabled");
+                    break;
+                }
+                
+                LOG_WARN("Adaptive VSync not supported by the driver. Using VSync");
+                mode = VSyncMode::On;
+                RenderThread::Submit([] { glfwSwapInterval(1); });
+                break;
+            }
+            
+            case VSyncMode::Off:
+            default:
+            {
+                mode = VSyncMode::Off;
+                RenderThread::Submit([] { glfwSwapInterval(0); });
+                LOG_DEBUG("VSync disabled");
+                break;
+            }
         }
         
-        m_WindowData.VSync = enable;
+        m_WindowData.vsyncMode = mode;
+        m_WindowData.VSync = (mode != VSyncMode::Off);
     }
     
     bool GNUWindow::IsVsyncEnabled() const
@@ -31,11 +31,22 @@ namespace Coconuts
         ~MacWindow();
             
         void OnUpdate() override;
+        void SwapBuffers() override;
+        void PollEvents() override;
+        void DispatchEvents() override;
+        void AttachContext() override;
+        void DetachContext() override;
         
         void SetEventCallback(const EventCallbackFunction& callbackFn) override
         {
             /* Make our MacWindow callback for events point to callbackFn */
             m_WindowData.eventCallback = callbackFn;
+            m_WindowData.eventQueue.SetCallback(callbackFn);
+        }
+        
+        const EventQueueStatistics& GetEventStatistics() const override
+        {
+            return m_WindowData.eventQueue.GetStatistics();
         }
         
         virtual void EventTrigger(Event& event) override
@@ -50,6 +61,9 @@ namespace Coconuts
         void SetVSync(bool enable) override;
         bool IsVsyncEnabled() const override;
         
+        void SetVSyncMode(VSyncMode mode) override;
+        VSyncMode GetVSyncMode() const override { return m_WindowData.vsyncMode; }
+        
         inline void* GetNativeWindow() const override { return p_glfwWindow; }
             
     private:
@@ -61,9 +75,13 @@ namespace Coconuts
             std::string title;
             uint32_t width, height;
             bool VSync;
+            VSyncMode vsyncMode;
             
             /* Called to dispatch any MacWindow Event */
             EventCallbackFunction eventCallback;
+            
+            /* Events polled this frame, dispatched in one batch */
+            EventQueue eventQueue;
         };   
         MacWindowData m_WindowData;
         
@@ -16,6 +16,8 @@
 
 #include "OpenGLFramebuffer.h"
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <coconuts/graphics/RenderThread.h>
 #include <glad/glad.h>
 
 namespace Coconuts
@@ -29,27 +31,39 @@ namespace Coconuts
     
     OpenGLFramebuffer::~OpenGLFramebuffer()
     {
-        glDeleteFramebuffers(1, &m_RendererID);
-        glDeleteTextures(1, &m_ColorAttachID);
-	glDeleteTextures(1, &m_DepthAttachID);
+        GLuint id = m_RendererID, color = m_ColorAttachID, depth = m_DepthAttachID;
+        RenderThread::Submit([id, color, depth]
+        {
+            glDeleteFramebuffers(1, &id);
+            glDeleteTextures(1, &color);
+            glDeleteTextures(1, &depth);
+        });
+        MemoryAccountant::Untrack(this);
     }
     
     void OpenGLFramebuffer::Bind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
-        glViewport(0, 0, m_Spec.width, m_Spec.height);
+        GLuint id = m_RendererID;
+        GLsizei width = (GLsizei) m_Spec.width, height = (GLsizei) m_Spec.height;
+        RenderThread::Submit([id, width, height]
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, id);
+            glViewport(0, 0, width, height);
+        });
     }
     
     void OpenGLFramebuffer::Unbind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        RenderThread::Submit([] { glBindFramebuffer(GL_FRAMEBUFFER, 0); });
     }
     
     void OpenGLFramebuffer::Resize(float width, float height)
     {
         m_Spec.width = width;
-        m_Spec.width = height;
-        Invalidate();
+        m_Spec.height = height;
+        
+        /* Attachments are recreated in place: wait for the render thread */
+        RenderThread::Sync([this] { Invalidate(); });
     }
     
     void OpenGLFramebuffer::Invalidate()
@@ -111,5 +125,9 @@ namespace Coconuts
         
         /* Unbind Framebuffer */
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        /* RGBA8 color + DEPTH24_STENCIL8 -> 4 bytes per texel each */
+        uint64_t texels = (uint64_t)m_Spec.width * (uint64_t)m_Spec.height;
+        MemoryAccountant::Track(this, MemoryCategory::FramebufferAttachment, texels * 4 + texels * 4);
     }
 }
\ No newline at end of file
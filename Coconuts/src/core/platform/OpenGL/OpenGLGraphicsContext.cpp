@@ -33,7 +33,7 @@ namespace Coconuts
             case TargetPlatform::Platform_MacOS:
             {
                 glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);//3
-                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);//2
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);//3 (sampler objects)
                 glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
                 glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
                 
@@ -44,7 +44,7 @@ namespace Coconuts
             case TargetPlatform::Platform_GNU:
             {
                 glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);//3
-                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);//2
+                glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);//3 (sampler objects)
                 glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
                 glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
                 
@@ -78,6 +78,13 @@ namespace Coconuts
             exit(1);
         }
         
+        /* Sampler objects (OpenGLSampler) are core since 3.3 */
+        if (!GLAD_GL_VERSION_3_3)
+        {
+            LOG_CRITICAL("OpenGL 3.3 is required, got {}. Exiting...", glGetString(GL_VERSION));
+            exit(1);
+        }
+        
         LOG_TRACE("Coconuts Graphics info:");
         LOG_TRACE("* Using OpenGL ver:  {}", glGetString(GL_VERSION));
         LOG_TRACE("* From vendor:       {}", glGetString(GL_VENDOR));
@@ -91,4 +98,14 @@ namespace Coconuts
         glfwSwapBuffers(windowHandle);
     }
     
+    void OpenGLGraphicsContext::MakeCurrent()
+    {
+        glfwMakeContextCurrent(windowHandle);
+    }
+    
+    void OpenGLGraphicsContext::Release()
+    {
+        glfwMakeContextCurrent(nullptr);
+    }
+    
 }
\ No newline at end of file
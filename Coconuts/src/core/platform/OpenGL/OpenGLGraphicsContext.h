@@ -37,6 +37,8 @@ namespace Coconuts
         static void PreInitHints(unsigned int platform);
         void Init() override;
         void SwapBuffers() override;
+        void MakeCurrent() override;
+        void Release() override;
         
     private:
         GLFWwindow* windowHandle;
@@ -15,6 +15,8 @@
  */
 
 #include "OpenGLIndexBuffer.h"
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <coconuts/graphics/RenderThread.h>
 #include <glad/glad.h>
 
 namespace Coconuts
@@ -32,22 +34,27 @@ namespace Coconuts
                      indices                    /* Data to be written in the Vertex Buffer */,
                      GL_STATIC_DRAW             /* Setup once */
                     );
+
+        MemoryAccountant::Track(this, MemoryCategory::IndexBuffer, count * sizeof(uint32_t));
     }
     
     OpenGLIndexBuffer::~OpenGLIndexBuffer()
     {
-        glDeleteBuffers(1, &m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glDeleteBuffers(1, &id); });
+        MemoryAccountant::Untrack(this);
     }
 
    
     void OpenGLIndexBuffer::Bind() const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id); });
     }
     
     void OpenGLIndexBuffer::Unbind() const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        RenderThread::Submit([] { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); });
     }
     
 }
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpenGLSampler.h"
+#include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
+
+namespace Coconuts
+{
+
+    OpenGLSampler::OpenGLSampler(const SamplerSpecification& spec)
+        : m_Spec(spec)
+    {
+        glGenSamplers(1, &m_RendererID);
+
+        glSamplerParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, MinFilter(m_Spec));
+        glSamplerParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, MagFilter(m_Spec));
+        glSamplerParameteri(m_RendererID, GL_TEXTURE_WRAP_S, Wrap(m_Spec.wrapS));
+        glSamplerParameteri(m_RendererID, GL_TEXTURE_WRAP_T, Wrap(m_Spec.wrapT));
+
+        float anisotropy = ClampAnisotropy(m_Spec.maxAnisotropy);
+        if (anisotropy > 0.0f)
+        {
+            glSamplerParameterf(m_RendererID, GL_TEXTURE_MAX_ANISOTROPY, anisotropy);
+        }
+    }
+
+    OpenGLSampler::~OpenGLSampler()
+    {
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glDeleteSamplers(1, &id); });
+    }
+
+    void OpenGLSampler::Bind(uint32_t slot) const
+    {
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id, slot] { glBindSampler(slot, id); });
+    }
+
+    //static
+    void OpenGLSampler::UnbindSlot(uint32_t slot)
+    {
+        RenderThread::Submit([slot] { glBindSampler(slot, 0); });
+    }
+
+    //static
+    GLenum OpenGLSampler::MinFilter(const SamplerSpecification& spec)
+    {
+        bool linear = (spec.minFilter == TextureFilter::Linear);
+
+        if (!spec.mipmaps)
+        {
+            return linear ? GL_LINEAR : GL_NEAREST;
+        }
+
+        if (spec.mipFilter == TextureFilter::Linear)
+        {
+            return linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR;
+        }
+
+        return linear ? GL_LINEAR_MIPMAP_NEAREST : GL_NEAREST_MIPMAP_NEAREST;
+    }
+
+    //static
+    GLenum OpenGLSampler::MagFilter(const SamplerSpecification& spec)
+    {
+        return (spec.magFilter == TextureFilter::Linear) ? GL_LINEAR : GL_NEAREST;
+    }
+
+    //static
+    GLenum OpenGLSampler::Wrap(TextureWrap wrap)
+    {
+        switch (wrap)
+        {
+            case TextureWrap::MirroredRepeat:   return GL_MIRRORED_REPEAT;
+            case TextureWrap::ClampToEdge:      return GL_CLAMP_TO_EDGE;
+            case TextureWrap::Repeat:
+            default:                            return GL_REPEAT;
+        }
+    }
+
+    //static
+    float OpenGLSampler::ClampAnisotropy(float requested)
+    {
+        /**
+         * Anisotropic filtering is core in GL 4.6 and an (ubiquitous)
+         * extension before. Query the limit once; a GL error means unsupported.
+         */
+        static float s_MaxSupported = -1.0f;
+
+        if (s_MaxSupported < 0.0f)
+        {
+            while (glGetError() != GL_NO_ERROR) {}  // clear stale errors
+
+            GLfloat max = 0.0f;
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &max);
+            s_MaxSupported = (glGetError() == GL_NO_ERROR) ? max : 0.0f;
+
+            LOG_DEBUG("OpenGLSampler - Max anisotropy supported: {}", s_MaxSupported);
+        }
+
+        if (requested <= 1.0f || s_MaxSupported <= 0.0f)
+        {
+            return 0.0f;
+        }
+
+        return (requested > s_MaxSupported) ? s_MaxSupported : requested;
+    }
+
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENGLSAMPLER_H
+#define OPENGLSAMPLER_H
+
+#include <coconuts/graphics/Sampler.h>
+#include <glad/glad.h>
+
+namespace Coconuts
+{
+
+    class OpenGLSampler : public Sampler
+    {
+    public:
+        OpenGLSampler(const SamplerSpecification& spec);
+        virtual ~OpenGLSampler();
+
+        virtual void Bind(uint32_t slot = 0) const override;
+
+        virtual const SamplerSpecification& GetSpecification() const override { return m_Spec; }
+
+        static void UnbindSlot(uint32_t slot);
+
+        /* Helpers shared with OpenGLTexture2D */
+        static GLenum MinFilter(const SamplerSpecification& spec);
+        static GLenum MagFilter(const SamplerSpecification& spec);
+        static GLenum Wrap(TextureWrap wrap);
+        static float ClampAnisotropy(float requested);  // 0.0 -> not supported by the driver
+
+    private:
+        SamplerSpecification m_Spec;
+        uint32_t m_RendererID;
+    };
+
+}
+
+#endif /* OPENGLSAMPLER_H */
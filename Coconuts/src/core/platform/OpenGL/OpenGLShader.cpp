@@ -18,6 +18,7 @@
 #include <glad/glad.h> 
 #include <vector>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/glm.hpp>
 #include <string>
@@ -497,7 +498,8 @@ namespace Coconuts
     
     OpenGLShader::~OpenGLShader()
     {
-        glDeleteProgram(m_ProgramID);
+        uint32_t program = m_ProgramID;
+        RenderThread::Submit([program] { glDeleteProgram(program); });
     }
     
     void OpenGLShader::DoneAttach()
@@ -572,13 +574,13 @@ namespace Coconuts
     
     void OpenGLShader::Bind()
     {
-        glUseProgram(m_ProgramID);
-        return;
+        uint32_t program = m_ProgramID;
+        RenderThread::Submit([program] { glUseProgram(program); });
     }
     
     void OpenGLShader::Unbind()
     {
-        glUseProgram(0);
+        RenderThread::Submit([] { glUseProgram(0); });
     }
     
     
@@ -589,47 +591,66 @@ namespace Coconuts
     
     void OpenGLShader::SetFloat1(const std::string& name, float value)
     {
-        UploadUniformFloat1(name, value);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, value] { UploadUniformFloat1(program, uniform, value); });
     }
     
     void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& values)
     {
-        UploadUniformFloat2(name, values);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, values] { UploadUniformFloat2(program, uniform, values); });
     }
     
     void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& values)
     {
-        UploadUniformFloat3(name, values);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, values] { UploadUniformFloat3(program, uniform, values); });
     }
     
     void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& values)
     {
-        UploadUniformFloat4(name, values);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, values] { UploadUniformFloat4(program, uniform, values); });
     }
     
     void OpenGLShader::SetInt1(const std::string& name, int value)
     {
-        UploadUniformInt1(name, value);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, value] { UploadUniformInt1(program, uniform, value); });
     }
     
     void OpenGLShader::SetMat2(const std::string& name, const glm::mat2& matrix)
     {
-        UploadUniformMat2(name, matrix);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, matrix] { UploadUniformMat2(program, uniform, matrix); });
     }
     
     void OpenGLShader::SetMat3(const std::string& name, const glm::mat3& matrix)
     {
-        UploadUniformMat3(name, matrix);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, matrix] { UploadUniformMat3(program, uniform, matrix); });
     }
     
     void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& matrix)
     {
-        UploadUniformMat4(name, matrix);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        RenderThread::Submit([program, uniform, matrix] { UploadUniformMat4(program, uniform, matrix); });
     }
     
     void OpenGLShader::SetSamplers2D(const std::string& name, int* values, uint32_t count)
     {
-        UploadUniformIntArray(name, values, count);
+        uint32_t program = m_ProgramID;
+        std::string uniform = name;
+        int* copy = (int*) RenderThread::Copy(values, count * sizeof(int));
+        RenderThread::Submit([program, uniform, copy, count] { UploadUniformIntArray(program, uniform, copy, count); });
     }
     
     
@@ -639,57 +660,66 @@ namespace Coconuts
      * - Interface Implementation
      */
         
-    void OpenGLShader::UploadUniformMat2(const std::string& name, const glm::mat2& matrix)
+    //static
+    void OpenGLShader::UploadUniformMat2(uint32_t program, const std::string& name, const glm::mat2& matrix)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str()); 
+        GLint location = glGetUniformLocation(program, name.c_str()); 
         glUniformMatrix2fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
     
-    void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix)
+    //static
+    void OpenGLShader::UploadUniformMat3(uint32_t program, const std::string& name, const glm::mat3& matrix)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str()); 
+        GLint location = glGetUniformLocation(program, name.c_str()); 
         glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
     
-    void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix)
+    //static
+    void OpenGLShader::UploadUniformMat4(uint32_t program, const std::string& name, const glm::mat4& matrix)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str()); 
+        GLint location = glGetUniformLocation(program, name.c_str()); 
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
     }
     
-    void OpenGLShader::UploadUniformFloat1(const std::string& name, float value)
+    //static
+    void OpenGLShader::UploadUniformFloat1(uint32_t program, const std::string& name, float value)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str());
+        GLint location = glGetUniformLocation(program, name.c_str());
         glUniform1f(location, value);   
     }
     
-    void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& values)
+    //static
+    void OpenGLShader::UploadUniformFloat2(uint32_t program, const std::string& name, const glm::vec2& values)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str());
+        GLint location = glGetUniformLocation(program, name.c_str());
         glUniform2f(location, values.x, values.y);
     }
    
-    void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& values)
+    //static
+    void OpenGLShader::UploadUniformFloat3(uint32_t program, const std::string& name, const glm::vec3& values)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str());
+        GLint location = glGetUniformLocation(program, name.c_str());
         glUniform3f(location, values.x, values.y, values.z);   
     }
     
-    void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& values)
+    //static
+    void OpenGLShader::UploadUniformFloat4(uint32_t program, const std::string& name, const glm::vec4& values)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str());
+        GLint location = glGetUniformLocation(program, name.c_str());
         glUniform4f(location, values.x, values.y, values.z, values.w);
     }
     
-    void OpenGLShader::UploadUniformInt1(const std::string& name, int value)
+    //static
+    void OpenGLShader::UploadUniformInt1(uint32_t program, const std::string& name, int value)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str());
+        GLint location = glGetUniformLocation(program, name.c_str());
         glUniform1i(location, value); 
     }
     
-    void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count)
+    //static
+    void OpenGLShader::UploadUniformIntArray(uint32_t program, const std::string& name, int* values, uint32_t count)
     {
-        GLint location = glGetUniformLocation(m_ProgramID, name.c_str());
+        GLint location = glGetUniformLocation(program, name.c_str());
         glUniform1iv(location, count, values); 
     }
 }
\ No newline at end of file
@@ -68,17 +68,17 @@ namespace Coconuts
         /**
          * Upload Uniforms Implementation
          */
-        void UploadUniformMat2(const std::string& name, const glm::mat2& matrix);
-        void UploadUniformMat3(const std::string& name, const glm::mat3& matrix);
-        void UploadUniformMat4(const std::string& name, const glm::mat4& matrix);
+        static void UploadUniformMat2(uint32_t program, const std::string& name, const glm::mat2& matrix);
+        static void UploadUniformMat3(uint32_t program, const std::string& name, const glm::mat3& matrix);
+        static void UploadUniformMat4(uint32_t program, const std::string& name, const glm::mat4& matrix);
         
-        void UploadUniformInt1(const std::string& name, int value);
-        void UploadUniformIntArray(const std::string& name, int* values, uint32_t count);
+        static void UploadUniformInt1(uint32_t program, const std::string& name, int value);
+        static void UploadUniformIntArray(uint32_t program, const std::string& name, int* values, uint32_t count);
         
-        void UploadUniformFloat1(const std::string& name, float value);
-        void UploadUniformFloat2(const std::string& name, const glm::vec2& values);
-        void UploadUniformFloat3(const std::string& name, const glm::vec3& values);
-        void UploadUniformFloat4(const std::string& name, const glm::vec4& values);
+        static void UploadUniformFloat1(uint32_t program, const std::string& name, float value);
+        static void UploadUniformFloat2(uint32_t program, const std::string& name, const glm::vec2& values);
+        static void UploadUniformFloat3(uint32_t program, const std::string& name, const glm::vec3& values);
+        static void UploadUniformFloat4(uint32_t program, const std::string& name, const glm::vec4& values);
         
     private:        
         virtual void AttachVertexShader(const std::string& filepath) override;
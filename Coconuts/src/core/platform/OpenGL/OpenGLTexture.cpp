@@ -17,6 +17,9 @@
 #include "OpenGLTexture.h"
 #include <stb/stb_image.h>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <coconuts/graphics/RenderThread.h>
+#include "OpenGLSampler.h"
 
 namespace Coconuts
 {
@@ -29,14 +32,13 @@ namespace Coconuts
         m_InternalFormat = internalFormat;
         m_DataFormat = dataFormat;
         
+        /* Generated textures are not minified much: plain bilinear */
+        m_Sampling.magFilter = TextureFilter::Linear;
+        m_Sampling.mipmaps = false;
+        
         glGenTextures(1, &m_RendererID);
         glBindTexture(GL_TEXTURE_2D, m_RendererID);
         
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        
         /* Specify a 2D Texture Image */        
         glTexImage2D(GL_TEXTURE_2D,
                      0, internalFormat,
@@ -46,15 +48,21 @@ namespace Coconuts
                      GL_UNSIGNED_BYTE,
                      data);
         
+        /* Full mip chain (a Sampler bound on top may request it) */
+        glGenerateMipmap(GL_TEXTURE_2D);
+        ApplySampling();
+        
         /* Unbind Texture */
         glBindTexture(GL_TEXTURE_2D, 0);
         
+        MemoryAccountant::Track(this, MemoryCategory::Texture2D, GetSizeBytes());
+        
         /* All good */
         validity = true;
     }
     
     OpenGLTexture2D::OpenGLTexture2D(const std::string& path)
-        :   m_Path(path), validity(false)
+        :   m_Path(path), m_RendererID(0), validity(false)
     {
         int width, height, channels;
         
@@ -77,6 +85,56 @@ namespace Coconuts
         m_Width = width;
         m_Height = height;
         
+        bool uploaded = UploadImage(data, channels);
+        
+        if (data)
+        {
+            stbi_image_free(data);
+        }
+        
+        /* All good */
+        validity = uploaded;
+    }
+    
+    OpenGLTexture2D::OpenGLTexture2D(const std::string& path, const void* encoded, uint64_t size)
+        :   m_Path(path), m_RendererID(0), validity(false)
+    {
+        int width, height, channels;
+        
+        /* Same as loading from path, minus the file read (already done by the caller) */
+        stbi_set_flip_vertically_on_load(1);
+        
+        stbi_uc* data = stbi_load_from_memory(static_cast<const stbi_uc*>(encoded), (int) size, &width, &height, &channels, 0);
+        
+        if (data == nullptr)
+        {
+            LOG_ERROR("OpenGLTexture2D - Could not decode image file! ( {} )", path);
+            LOG_ERROR("{}", stbi_failure_reason());
+            return;
+        }
+        
+        m_Width = width;
+        m_Height = height;
+        
+        bool uploaded = UploadImage(data, channels);
+        stbi_image_free(data);
+        
+        /* All good */
+        validity = uploaded;
+    }
+    
+    OpenGLTexture2D::OpenGLTexture2D(const std::string& path, uint32_t width, uint32_t height, uint32_t channels, const void* pixels)
+        :   m_Width(width), m_Height(height), m_Path(path), m_RendererID(0), validity(false)
+    {
+        /**
+         * Cooked pixels are already decoded and flipped vertically.
+         * They are read straight from where they live (e.g. a memory mapped archive).
+         */
+        validity = UploadImage(pixels, channels);
+    }
+    
+    bool OpenGLTexture2D::UploadImage(const void* pixels, uint32_t channels)
+    {
         GLenum internalFormat = 0;
         GLenum dataFormat = 0;
         
@@ -90,6 +148,11 @@ namespace Coconuts
             internalFormat = GL_RGB8;
             dataFormat = GL_RGB;
         }
+        else
+        {
+            LOG_ERROR("OpenGLTexture2D - Unsupported number of channels ({}) for {}", channels, m_Path);
+            return false;
+        }
         
         m_InternalFormat = internalFormat;
         m_DataFormat = dataFormat;
@@ -97,11 +160,6 @@ namespace Coconuts
         glGenTextures(1, &m_RendererID);
         glBindTexture(GL_TEXTURE_2D, m_RendererID);
         
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        
         /* Specify a 2D Texture Image */        
         glTexImage2D(GL_TEXTURE_2D,
                      0, internalFormat,
@@ -109,43 +167,115 @@ namespace Coconuts
                      0,
                      dataFormat,
                      GL_UNSIGNED_BYTE,
-                     data);
+                     pixels);
+        
+        /**
+         * Mip chain, so zoomed out scenes sample a level close to
+         * on-screen size instead of thrashing the cache on level 0.
+         * Default: trilinear minification, nearest magnification.
+         */
+        glGenerateMipmap(GL_TEXTURE_2D);
+        ApplySampling();
         
         /* Unbind Texture */
         glBindTexture(GL_TEXTURE_2D, 0);
         
-        if (data)
-        {
-            stbi_image_free(data);
-        }
+        MemoryAccountant::Track(this, MemoryCategory::Texture2D, GetSizeBytes());
         
-        /* All good */
-        validity = true;
+        return true;
     }
     
     OpenGLTexture2D::~OpenGLTexture2D()
     {
-        glDeleteTextures(1, &m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glDeleteTextures(1, &id); });
+        MemoryAccountant::Untrack(this);
     }
     
     void OpenGLTexture2D::SetData(void* data, uint32_t size)
     {
-        //glGenTextures(1, &m_RendererID);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        const void* pixels = RenderThread::Copy(data, size);
+        GLuint id = m_RendererID;
+        GLenum internalFormat = m_InternalFormat, dataFormat = m_DataFormat;
+        uint32_t width = m_Width, height = m_Height;
         
-        /* Specify a 2D Texture Image */        
-        glTexImage2D(GL_TEXTURE_2D,
-                     0, m_InternalFormat,
-                     m_Width, m_Height,
-                     0,
-                     m_DataFormat,
-                     GL_UNSIGNED_BYTE,
-                     data);
+        RenderThread::Submit([id, pixels, internalFormat, dataFormat, width, height]
+        {
+            glBindTexture(GL_TEXTURE_2D, id);
+            
+            /* Specify a 2D Texture Image */        
+            glTexImage2D(GL_TEXTURE_2D,
+                         0, internalFormat,
+                         width, height,
+                         0,
+                         dataFormat,
+                         GL_UNSIGNED_BYTE,
+                         pixels);
+            
+            /* Keep mip chain in sync with level 0 */
+            glGenerateMipmap(GL_TEXTURE_2D);
+        });
+    }
+    
+    uint64_t OpenGLTexture2D::GetSizeBytes() const
+    {
+        uint64_t bytesPerPixel = (m_DataFormat == GL_RGB) ? 3 : 4;
+        uint64_t size = 0;
+        uint32_t width = m_Width, height = m_Height;
+        
+        /* Level 0 plus every mip level down to 1x1 */
+        while (true)
+        {
+            size += (uint64_t) width * height * bytesPerPixel;
+            if (width == 1 && height == 1) break;
+            width = (width > 1) ? width / 2 : 1;
+            height = (height > 1) ? height / 2 : 1;
+        }
+        
+        return size;
+    }
+    
+    void OpenGLTexture2D::SetSampling(const SamplerSpecification& spec)
+    {
+        m_Sampling = spec;
+        
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id, spec]
+        {
+            glBindTexture(GL_TEXTURE_2D, id);
+            ApplySampling(spec);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        });
+    }
+    
+    void OpenGLTexture2D::ApplySampling()
+    {
+        ApplySampling(m_Sampling);
+    }
+    
+    //static
+    void OpenGLTexture2D::ApplySampling(const SamplerSpecification& spec)
+    {
+        /* Expects texture to be bound */
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, OpenGLSampler::MinFilter(spec));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, OpenGLSampler::MagFilter(spec));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, OpenGLSampler::Wrap(spec.wrapS));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, OpenGLSampler::Wrap(spec.wrapT));
+        
+        float anisotropy = OpenGLSampler::ClampAnisotropy(spec.maxAnisotropy);
+        if (anisotropy > 0.0f)
+        {
+            glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, anisotropy);
+        }
     }
     
     void OpenGLTexture2D::Bind(uint32_t slot) const
     {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id, slot]
+        {
+            glActiveTexture(GL_TEXTURE0 + slot);
+            glBindTexture(GL_TEXTURE_2D, id);
+        });
     }
 }
\ No newline at end of file
@@ -29,15 +29,22 @@ namespace Coconuts
     public:
         OpenGLTexture2D(uint32_t width, uint32_t height, void* data, uint32_t size);
         OpenGLTexture2D(const std::string& path);
+        OpenGLTexture2D(const std::string& path, const void* encoded, uint64_t size);
+        OpenGLTexture2D(const std::string& path, uint32_t width, uint32_t height, uint32_t channels, const void* pixels);
         virtual ~OpenGLTexture2D();
         
         uint32_t GetWidth() const override { return m_Width; }
         uint32_t GetHeight() const override { return m_Height; }
         
+        uint64_t GetSizeBytes() const override;
+        
         virtual void SetData(void* data, uint32_t size) override;
         
         void Bind(uint32_t slot = 0) const override;
         
+        virtual void SetSampling(const SamplerSpecification& spec) override;
+        virtual const SamplerSpecification& GetSampling() const override { return m_Sampling; }
+        
         virtual bool operator == (const Texture& other) const override
         {
             return m_RendererID == ((OpenGLTexture2D&)other).m_RendererID;
@@ -50,12 +57,20 @@ namespace Coconuts
         
     private:
         virtual bool IsValid() override { return validity; }
+        
+        /* Upload decoded image pixels (m_Width x m_Height) */
+        bool UploadImage(const void* pixels, uint32_t channels);
+        
+        /* Apply m_Sampling to the bound texture */
+        void ApplySampling();
+        static void ApplySampling(const SamplerSpecification& spec);
                 
     private:
         uint32_t m_Width, m_Height;
         std::string m_Path;
         uint32_t m_RendererID;
         GLenum m_InternalFormat, m_DataFormat;
+        SamplerSpecification m_Sampling;
         bool validity;
     };
     
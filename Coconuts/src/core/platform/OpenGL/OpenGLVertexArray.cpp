@@ -18,6 +18,7 @@
 #include <glad/glad.h>
 #include <coconuts/graphics/BufferLayout.h>
 #include <coconuts/Logger.h>
+#include <coconuts/graphics/RenderThread.h>
 
 #include <stdint.h>     /* uintptr_t */
 #define INT2VOIDP(i) (void*)(uintptr_t)(i)
@@ -65,43 +66,51 @@ namespace Coconuts
     
     OpenGLVertexArray::~OpenGLVertexArray()
     {
-        glDeleteVertexArrays(1, &m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glDeleteVertexArrays(1, &id); });
     }
         
     void OpenGLVertexArray::Bind() const
     {
-        glBindVertexArray(m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glBindVertexArray(id); });
     }
     
     void OpenGLVertexArray::Unbind() const
     {
-        glBindVertexArray(0);
+        RenderThread::Submit([] { glBindVertexArray(0); });
     }
         
     void OpenGLVertexArray::AddVertexBuffer(std::shared_ptr<VertexBuffer>& vertexBuffer)
     {
-        glBindVertexArray(m_RendererID);
-        vertexBuffer->Bind();
+        GLuint id = m_RendererID;
+        std::shared_ptr<VertexBuffer> buffer = vertexBuffer;
         
-         uint32_t index = 0;
-        for (const auto& element : vertexBuffer->GetLayout())
+        RenderThread::Submit([id, buffer]
         {
-
-            /* Enable a vertex attribute */
-            glEnableVertexAttribArray(index);
-            
-            GLvoid* offset_ptr;
-            offset_ptr = INT2VOIDP(element.offset); /* avoid compiler warnings due to casting */
-            
-            glVertexAttribPointer(index,
-                                  element.GetComponentCount(),
-                                  ShaderDataTypeToOpenGLBaseType(element.type),
-                                  element.normalized ? GL_TRUE : GL_FALSE,
-                                  vertexBuffer->GetLayout().GetStride(),
-                                  offset_ptr);
+            glBindVertexArray(id);
+            buffer->Bind();
             
-            index++;
-        }
+            uint32_t index = 0;
+            for (const auto& element : buffer->GetLayout())
+            {
+                
+                /* Enable a vertex attribute */
+                glEnableVertexAttribArray(index);
+                
+                GLvoid* offset_ptr;
+                offset_ptr = INT2VOIDP(element.offset); /* avoid compiler warnings due to casting */
+                
+                glVertexAttribPointer(index,
+                                      element.GetComponentCount(),
+                                      ShaderDataTypeToOpenGLBaseType(element.type),
+                                      element.normalized ? GL_TRUE : GL_FALSE,
+                                      buffer->GetLayout().GetStride(),
+                                      offset_ptr);
+                
+                index++;
+            }
+        });
          
          m_VertexBuffers.push_back(vertexBuffer);
          
@@ -110,8 +119,14 @@ namespace Coconuts
     
     void OpenGLVertexArray::SetIndexBuffer(std::shared_ptr<IndexBuffer>& indexBuffer)
     {
-        glBindVertexArray(m_RendererID);
-        indexBuffer->Bind();
+        GLuint id = m_RendererID;
+        std::shared_ptr<IndexBuffer> buffer = indexBuffer;
+        
+        RenderThread::Submit([id, buffer]
+        {
+            glBindVertexArray(id);
+            buffer->Bind();
+        });
         
         m_IndexBuffer = indexBuffer;
     }
@@ -15,6 +15,8 @@
  */
 
 #include "OpenGLVertexBuffer.h"
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <coconuts/graphics/RenderThread.h>
 #include <glad/glad.h>
 
 namespace Coconuts
@@ -31,6 +33,8 @@ namespace Coconuts
                      nullptr,
                      GL_DYNAMIC_DRAW    /* Data is expected to be written dynamically */
                     );
+
+        MemoryAccountant::Track(this, MemoryCategory::VertexBuffer, size);
     }
 
     
@@ -45,27 +49,39 @@ namespace Coconuts
                      vertices           /* Data to be written in the Vertex Buffer */,
                      GL_STATIC_DRAW     /* Setup once */
                     );
+
+        MemoryAccountant::Track(this, MemoryCategory::VertexBuffer, size);
     }
     
     OpenGLVertexBuffer::~OpenGLVertexBuffer()
     {
-        glDeleteBuffers(1, &m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glDeleteBuffers(1, &id); });
+        MemoryAccountant::Untrack(this);
     }
     
     void OpenGLVertexBuffer::Bind() const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        GLuint id = m_RendererID;
+        RenderThread::Submit([id] { glBindBuffer(GL_ARRAY_BUFFER, id); });
     }
     
     void OpenGLVertexBuffer::Unbind() const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        RenderThread::Submit([] { glBindBuffer(GL_ARRAY_BUFFER, 0); });
     }
     
     void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+        /* Caller may reuse data right away (batch staging buffer) */
+        const void* copy = RenderThread::Copy(data, size);
+        GLuint id = m_RendererID;
+        
+        RenderThread::Submit([id, copy, size]
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, id);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, size, copy);
+        });
     }
     
 }
\ No newline at end of file
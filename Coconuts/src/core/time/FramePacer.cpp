@@ -0,0 +1,197 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <coconuts/time/FramePacer.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <thread>
+#include <cmath>
+
+namespace Coconuts
+{
+    
+    namespace
+    {
+        struct PacerState
+        {
+            float targetFPS         = 0.0f;
+            int64_t periodNs        = 0;
+            int64_t spinThresholdNs = 2000000;  /* 2 ms */
+            int64_t nextDeadlineNs  = 0;
+            int64_t lastFrameEndNs  = 0;
+            uint32_t missedDeadlines = 0;
+            
+            /* Ring buffers (ns) */
+            int64_t frameTimes[FramePacer::HISTORY_SIZE] = {0};
+            int64_t sleepTimes[FramePacer::HISTORY_SIZE] = {0};
+            int64_t spinTimes[FramePacer::HISTORY_SIZE]  = {0};
+            uint32_t head   = 0;
+            uint32_t count  = 0;
+        };
+        
+        PacerState s_State;
+        
+        inline float ToMilliseconds(int64_t ns)
+        {
+            return (float) ((double) ns * 1.0e-6);
+        }
+    }
+    
+    constexpr uint32_t FramePacer::HISTORY_SIZE;
+    
+    //static
+    void FramePacer::SetTargetFPS(float fps)
+    {
+        s_State.targetFPS = (fps > 0.0f) ? fps : 0.0f;
+        s_State.periodNs = (fps > 0.0f) ? Clock::SecondsToNanoseconds(1.0 / fps) : 0;
+        s_State.nextDeadlineNs = 0;     /* resync on next frame */
+        s_State.missedDeadlines = 0;
+        
+        LOG_DEBUG("FramePacer - Target FPS: {} (0 -> unlimited)", s_State.targetFPS);
+    }
+    
+    //static
+    float FramePacer::GetTargetFPS()
+    {
+        return s_State.targetFPS;
+    }
+    
+    //static
+    void FramePacer::SetSpinThreshold(float milliseconds)
+    {
+        s_State.spinThresholdNs = (milliseconds > 0.0f) ? (int64_t) (milliseconds * 1.0e6) : 0;
+    }
+    
+    //static
+    float FramePacer::GetSpinThreshold()
+    {
+        return ToMilliseconds(s_State.spinThresholdNs);
+    }
+    
+    //static
+    void FramePacer::EndFrame()
+    {
+        int64_t now = Clock::NowNanoseconds();
+        int64_t slept = 0, spun = 0;
+        
+        if (s_State.periodNs > 0)
+        {
+            if (s_State.nextDeadlineNs == 0)
+            {
+                s_State.nextDeadlineNs = now + s_State.periodNs;
+            }
+            
+            int64_t remaining = s_State.nextDeadlineNs - now;
+            
+            /* (1) Coarse: let the OS have the core */
+            if (remaining > s_State.spinThresholdNs)
+            {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - s_State.spinThresholdNs));
+                int64_t woke = Clock::NowNanoseconds();
+                slept = woke - now;
+                now = woke;
+            }
+            
+            /* (2) Fine: spin the rest */
+            int64_t spinStart = now;
+            while (now < s_State.nextDeadlineNs)
+            {
+                std::this_thread::yield();
+                now = Clock::NowNanoseconds();
+            }
+            spun = now - spinStart;
+            
+            /* Next deadline: fixed cadence, unless we're a whole period late */
+            s_State.nextDeadlineNs += s_State.periodNs;
+            if (s_State.nextDeadlineNs <= now)
+            {
+                s_State.missedDeadlines++;
+                s_State.nextDeadlineNs = now + s_State.periodNs;
+            }
+        }
+        
+        /* Record */
+        if (s_State.lastFrameEndNs != 0)
+        {
+            s_State.frameTimes[s_State.head] = now - s_State.lastFrameEndNs;
+            s_State.sleepTimes[s_State.head] = slept;
+            s_State.spinTimes[s_State.head]  = spun;
+            s_State.head = (s_State.head + 1) % HISTORY_SIZE;
+            s_State.count = std::min(s_State.count + 1, HISTORY_SIZE);
+        }
+        
+        s_State.lastFrameEndNs = now;
+    }
+    
+    //static
+    FramePacerStatistics FramePacer::GetStatistics()
+    {
+        FramePacerStatistics stats;
+        stats.missedDeadlines = s_State.missedDeadlines;
+        
+        uint32_t count = s_State.count;
+        if (count == 0)
+        {
+            return stats;
+        }
+        
+        int64_t sorted[HISTORY_SIZE];
+        double sum = 0.0, sleepSum = 0.0, spinSum = 0.0;
+        
+        for (uint32_t i = 0; i < count; i++)
+        {
+            sorted[i] = s_State.frameTimes[i];
+            sum += (double) s_State.frameTimes[i];
+            sleepSum += (double) s_State.sleepTimes[i];
+            spinSum += (double) s_State.spinTimes[i];
+        }
+        
+        double mean = sum / count;
+        double variance = 0.0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            double delta = (double) s_State.frameTimes[i] - mean;
+            variance += delta * delta;
+        }
+        variance /= count;
+        
+        std::sort(sorted, sorted + count);
+        uint32_t p99 = std::min(count - 1, (uint32_t) std::ceil(0.99 * count) - 1);
+        
+        uint32_t last = (s_State.head + HISTORY_SIZE - 1) % HISTORY_SIZE;
+        
+        stats.lastFrameMs       = ToMilliseconds(s_State.frameTimes[last]);
+        stats.averageFrameMs    = (float) (mean * 1.0e-6);
+        stats.minFrameMs        = ToMilliseconds(sorted[0]);
+        stats.maxFrameMs        = ToMilliseconds(sorted[count - 1]);
+        stats.percentile99Ms    = ToMilliseconds(sorted[p99]);
+        stats.jitterMs          = (float) (std::sqrt(variance) * 1.0e-6);
+        stats.averageSleepMs    = (float) (sleepSum / count * 1.0e-6);
+        stats.averageSpinMs     = (float) (spinSum / count * 1.0e-6);
+        
+        return stats;
+    }
+    
+    //static
+    void FramePacer::ResetStatistics()
+    {
+        s_State.head = 0;
+        s_State.count = 0;
+        s_State.missedDeadlines = 0;
+    }
+    
+}
@@ -115,6 +115,7 @@ namespace Coconuts
         m_AssetsMenu.Init(&m_ShowPopUp_ImportTexture2D, &m_ShowPopUp_CreateSprite);
         m_FileMenu.Init(m_GameLayerPtr, &m_ShowPopUp_LoadProject, &m_ShowPopUp_SaveProject);
         m_EntityMenu.Init(m_GameLayerPtr);
+        m_SceneMenu.Init(m_GameLayerPtr, &m_ComponentInspectorPanel);
 
         /* Panels */
         m_ViewportPanel.Init(m_GameLayerPtr, m_FramebufferPtr);
@@ -251,6 +252,9 @@ namespace Coconuts
             /* Assets Menu */
             m_AssetsMenu.Draw();
             
+            /* Scene Menu */
+            m_SceneMenu.Draw();
+            
             ImGui::EndMenuBar();
         }
         
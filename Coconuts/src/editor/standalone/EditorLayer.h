@@ -27,6 +27,7 @@
 #include "menu_bar/FileMenu.h"
 #include "menu_bar/EntityMenu.h"
 #include "menu_bar/AssetsMenu.h"
+#include "menu_bar/SceneMenu.h"
 
 /* Panels */
 #include "panels/Viewport.h"
@@ -85,6 +86,7 @@ namespace Coconuts
         MenuBar::FileMenu               m_FileMenu;
         MenuBar::EntityMenu             m_EntityMenu;
         MenuBar::AssetsMenu             m_AssetsMenu;
+        MenuBar::SceneMenu              m_SceneMenu;
 
         /* Panels */
         Panels::Viewport                m_ViewportPanel;
@@ -18,12 +18,70 @@
 #include <coconuts/Logger.h>
 #include <coconuts/types.h>
 #include <coconuts/FileSystem.h>
+#include <coconuts/time/FramePacer.h>
+#include <coconuts/graphics/RenderThread.h>
+#include <coconuts/input/InputRecorder.h>
 
 
+/**
+ * Usage: ccneditor [--game] [--record <tape>] [--replay <tape>]
+ *   --game             game only, on the render thread (no editor GUI)
+ *   --record <tape>    records input and frame times, saved to <tape> on exit
+ *   --replay <tape>    plays <tape> back instead of the devices and the clock
+ */
 int main(int argc, char* argv[])
 {
     Coconuts::StandaloneApp app( (std::string(argv[0])) );
-    app.StartEditor();
+
+    bool gameOnly = false;
+    std::string recordPath;
+    std::string replayPath;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg(argv[i]);
+
+        if (arg == "--game")
+        {
+            gameOnly = true;
+        }
+        else if (arg == "--record" && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+        else
+        {
+            LOG_WARN("Unknown argument {}", arg);
+        }
+    }
+
+    if (!replayPath.empty() && Coconuts::InputRecorder::Load(replayPath))
+    {
+        Coconuts::InputRecorder::StartReplay();
+    }
+    else if (!recordPath.empty())
+    {
+        Coconuts::InputRecorder::StartRecording();
+    }
+
+    if (gameOnly)
+    {
+        app.StartGameNoEditor();
+    }
+    else
+    {
+        app.StartEditor();
+    }
+
+    if (Coconuts::InputRecorder::IsRecording())
+    {
+        Coconuts::InputRecorder::StopRecording();
+        Coconuts::InputRecorder::Save(recordPath);
+    }
     return 0;
 }
 
@@ -88,7 +146,8 @@ namespace Coconuts
             p_GameApp->Run();           // Game Loop (1 frame)
             m_FramebufferPtr->Unbind();
 
-            p_EditorWindow->OnUpdate(); // Refresh window
+            p_EditorWindow->OnUpdate(); // Refresh window, dispatch this frame's events
+            FramePacer::EndFrame();     // Wait for next frame's slot
         }
     }
 
@@ -96,11 +155,25 @@ namespace Coconuts
     {
         m_IsRunning = true;
 
+        /* Late frames tear instead of dropping to half the refresh rate */
+        p_EditorWindow->SetVSyncMode(VSyncMode::Adaptive);
+
+        /**
+         * No ImGui here: the render thread takes the GL context.
+         * It executes and presents frame N-1 while frame N is simulated and recorded.
+         */
+        RenderThread::Start(*p_EditorWindow);
+
         while(m_IsRunning)
         {
-            p_GameApp->Run();           // Game Loop (1 frame)
-            p_EditorWindow->OnUpdate(); // Refresh window
+            p_EditorWindow->PollEvents();       // Events (resize, input) queued...
+            p_EditorWindow->DispatchEvents();   // ...and dispatched in one batch, before recording
+            p_GameApp->Run();                   // Game Loop (1 frame), recorded
+            RenderThread::EndFrame();           // Hand frame over to the render thread
+            FramePacer::EndFrame();             // Wait for next frame's slot
         }
+
+        RenderThread::Stop();
     }
 
     void StandaloneApp::OnEvent(Event& event)
@@ -33,8 +33,8 @@ namespace Coconuts
         StandaloneApp(const std::string& appname);
         ~StandaloneApp();
 
-        void StartEditor(void);
-        void StartGameNoEditor(void);   // render game graphics as they are
+        void StartEditor(void);         // single threaded: ImGui drives the GL context
+        void StartGameNoEditor(void);   // render game graphics as they are, on the render thread (--game)
     
     private:
         void OnEvent(Event& event);
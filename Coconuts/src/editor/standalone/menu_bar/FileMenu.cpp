@@ -47,12 +47,15 @@ namespace MenuBar
                 OpenProject();
             }
             
-            if (ImGui::MenuItem("Save", "", false, true))
+            /* Save the edited Scenes, not a playing copy */
+            bool editing = !m_GameLayerPtr->IsPlaying();
+            
+            if (ImGui::MenuItem("Save", "", false, editing))
             {
                 SaveProject();
             }
             
-            if (ImGui::MenuItem("Save Project As...", "", false, true))
+            if (ImGui::MenuItem("Save Project As...", "", false, editing))
             {
                 SaveProjectAs();
             }
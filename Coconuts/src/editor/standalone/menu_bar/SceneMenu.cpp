@@ -0,0 +1,71 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SceneMenu.h"
+#include <coconuts/editor.h>
+#include <coconuts/Logger.h>
+
+namespace Coconuts {
+namespace MenuBar
+{
+    
+    bool SceneMenu::Init(GameLayer*& gameLayer, Panels::ComponentInspector* cmpInsp)
+    {
+        m_GameLayerPtr = gameLayer;
+        m_ComponentInspectorPtr = cmpInsp;
+        return true;
+    }
+    
+    void SceneMenu::Draw()
+    {
+        if (ImGui::BeginMenu("Scene"))
+        {
+            bool playing = m_GameLayerPtr->IsPlaying();
+            
+            if (ImGui::MenuItem("Play", "", false, !playing))
+            {
+                LOG_TRACE("Scene Menu: Play");
+                Play();
+            }
+            
+            if (ImGui::MenuItem("Stop", "", false, playing))
+            {
+                LOG_TRACE("Scene Menu: Stop");
+                Stop();
+            }
+            
+            ImGui::EndMenu();
+        }
+    }
+    
+    void SceneMenu::Play()
+    {
+        /* Clear context */
+        m_ComponentInspectorPtr->Init();
+        
+        m_GameLayerPtr->BeginPlay();
+    }
+    
+    void SceneMenu::Stop()
+    {
+        /* Clear context */
+        m_ComponentInspectorPtr->Init();
+        
+        m_GameLayerPtr->EndPlay();
+    }
+    
+}
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SCENEMENU_H
+#define SCENEMENU_H
+
+#include <coconuts/layer_system/GameLayer.h>
+#include "../panels/ComponentInspector.h"
+
+namespace Coconuts {
+namespace MenuBar
+{
+    
+    class SceneMenu
+    {
+    public:
+        SceneMenu() = default;
+        bool Init(GameLayer*& gameLayer, Panels::ComponentInspector* cmpInsp);
+        
+        void Draw();
+        
+    private:
+        void Play();
+        void Stop();
+        
+    private:
+        /* Pointer to the GameLayer */
+        GameLayer* m_GameLayerPtr;
+        
+        /* Its context belongs to the Scene being swapped */
+        Panels::ComponentInspector* m_ComponentInspectorPtr;
+    };
+    
+}
+}
+
+#endif /* SCENEMENU_H */
@@ -18,6 +18,7 @@
 #include <coconuts/editor.h>
 #include <coconuts/AssetManager.h>
 #include <coconuts/graphics/Texture.h>
+#include <coconuts/graphics/MemoryAccountant.h>
 #include <coconuts/Logger.h>
 #include <tuple>
 #include <string.h>
@@ -69,6 +70,30 @@ namespace Panels
         auto texture = AssetManager::GetTexture2D(m_LogicalNameTexture2D);
         ImGui::Image((void *) *texture, ImVec2((texture->GetWidth()/3), (texture->GetHeight()/3)), ImVec2{0, 1}, ImVec2{1, 0});
         
+        ImGui::Spacing(); ImGui::Spacing();
+        
+        /* Memory (resources are tracked by their most derived object) */
+        uint64_t textureBytes = MemoryAccountant::GetBytes(dynamic_cast<const void*>(texture.get()));
+        ImGui::Text("%u x %u", texture->GetWidth(), texture->GetHeight());
+        ImGui::Text("VRAM: %.1f KB (incl. mipmaps)", textureBytes / 1024.0f);
+        
+        ImGui::Spacing(); ImGui::Spacing();
+        
+        /* Deduplication */
+        auto aliases = AssetManager::GetTexture2DAliases(m_LogicalNameTexture2D);
+        if (!aliases.empty())
+        {
+            ImGui::Text("Shares GPU texture with");
+            for (auto& alias : aliases)
+            {
+                ImGui::BulletText("%s", alias.c_str());
+            }
+        }
+        
+        auto dedup = AssetManager::GetTexture2DDedupStats();
+        ImGui::TextDisabled("Dedup: %u textures, %u aliased names, %.1f KB saved",
+                            dedup.uniqueTextures, dedup.aliasedNames, dedup.savedBytes / 1024.0f);
+        
         
         ImGui::Spacing(); ImGui::Spacing();
         ImGui::Spacing(); ImGui::Spacing();
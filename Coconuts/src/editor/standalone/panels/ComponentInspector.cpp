@@ -22,6 +22,7 @@
 #include <coconuts/AssetManager.h>
 #include <coconuts/Logger.h>
 #include <coconuts/graphics/defs.h>
+#include <coconuts/ecs/Prefab.h>
 #include "../ed_utils.h"
 
 namespace Coconuts {
@@ -105,6 +106,10 @@ namespace Panels
             
             /* Add Component */
             DrawButtonAddComponent();
+            
+            /* Save as Prefab */
+            ImGui::SameLine();
+            DrawButtonSaveAsPrefab();
         }
         
         else
@@ -338,7 +343,6 @@ namespace Panels
     {
         BehaviorComponent& behaviorcomponent = m_Context->GetComponent<BehaviorComponent>();
         
-        //TODO
         ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_DefaultOpen;
         bool open = ImGui::TreeNodeEx("Behavior Component" , flags);
  
@@ -346,7 +350,7 @@ namespace Panels
         if (open)
         {
             ImGui::Spacing(); ImGui::Spacing();
-            ImGui::TextDisabled("TODO");
+            ImGui::Text("Behaviors: %u", behaviorcomponent.GetBehaviorCount());
             ImGui::TreePop();
         }
     }
@@ -354,6 +358,22 @@ namespace Panels
     
     /* ************************************************************************* */
     /* Add Component Button */
+    void ComponentInspector::DrawButtonSaveAsPrefab()
+    {
+        if (!m_Context->HasComponent<TagComponent>())
+        {
+            return;
+        }
+        
+        /* Named after the Entity's tag: saving it again replaces the Prefab */
+        if (ImGui::Button("Save as Prefab"))
+        {
+            const std::string& name = m_Context->ReadComponent<TagComponent>().tag;
+            PrefabLibrary::Add(Prefab::FromEntity(name, *m_Context));
+            LOG_INFO("Saved Entity {} as Prefab {}", m_Context->GetId(), name);
+        }
+    }
+    
     void ComponentInspector::DrawButtonAddComponent()
     {
         if (ImGui::Button("Add Component"))
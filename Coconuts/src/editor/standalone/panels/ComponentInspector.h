@@ -47,6 +47,7 @@ namespace Panels
         
         /* Add Component Button */
         void DrawButtonAddComponent(void);
+        void DrawButtonSaveAsPrefab(void);
          
         /* Context */
         Coconuts::Entity* m_Context;
@@ -40,107 +40,126 @@ namespace Panels
     
     void SceneOverview::Draw()
     {
-        if ( m_GameLayerPtr->IsActiveSceneUpdated() )
-        {
-            GetLastSceneUpdate();
-        }
+        BindActiveScene();
+        ForgetChangedTags();
+        
+        /* Close holes left by destroyed entities (one pass, only if any) */
+        EntityList& list = *m_EntityListPtr;
+        list.Compact();
         
         ImGui::Begin("Scene Overview");
-        for (Entity thisEntity : sceneEntities)
-        {            
-            /* Draw all entities */
-            if (DrawNode(thisEntity))
+        ImGui::TextDisabled("%zu entities", list.GetSize());
+        ImGui::Separator();
+        
+        /* Rows have a fixed height: only the visible ones are submitted */
+        ImGuiListClipper clipper;
+        clipper.Begin((int) list.GetSize());
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
             {
-                /**
-                 * thisEntity is currently selected.
-                 * Update Component Inspector panel context to draw its
-                 * components.
-                 */ 
-                
-                /* Avoid spawn of unnecessary context-changes */
-                if (m_CurrentSelectedEntityPtr->GetId() != thisEntity.GetId())
-                {
-                    *m_CurrentSelectedEntityPtr = thisEntity;
-                    m_ComponentInspectorPtr->ChangeContext(m_CurrentSelectedEntityPtr);
-                }
-                
+                DrawRow(list.Get(i));
             }
-
-            ImGui::Spacing();
         }
+        clipper.End();
+        
         ImGui::End();
     }
     
-    void SceneOverview::GetLastSceneUpdate()
+    void SceneOverview::BindActiveScene()
     {
-        /* Get tmp vector from Game Layer with al entities */
-        std::vector<Entity> last = m_GameLayerPtr->GetActiveSceneEntities();
+        std::shared_ptr<Scene> active = m_GameLayerPtr->GetActiveScene();
+        std::shared_ptr<Scene> bound = m_BoundScene.lock();
+        if (active == bound)
+        {
+            return;
+        }
         
-        /* Free heap vector and re-allocate */
-        sceneEntities = std::vector<Entity>();
-        sceneEntities.resize(last.size());
+        /* The previous Scene may come back (play mode): stop holding its changes */
+        if (bound)
+        {
+            bound->GetChangeTracker().RemoveConsumer<TagComponent>(m_TagConsumer);
+        }
         
-        /* Copy */
-        sceneEntities = last;
+        /* Another Scene: its tags are watched from now on */
+        m_BoundScene = active;
+        m_EntityListPtr = &active->GetEntityList();
+        m_TagConsumer = active->GetChangeTracker().AddConsumer<TagComponent>();
+        m_Rows.clear();
+        m_SelectedId = 0;
     }
     
-    bool SceneOverview::DrawNode(Entity& entity)
+    void SceneOverview::ForgetChangedTags()
     {
-        std::string tag = entity.GetComponent<TagComponent>().tag;
-        static uint64_t context_id = 0;
+        m_ChangedTags.clear();
+        m_GameLayerPtr->GetActiveSceneChangeTracker().CollectChanges<TagComponent>(m_TagConsumer, m_ChangedTags);
         
-        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnArrow;
-        flags |= context_id == entity.GetId() ? ImGuiTreeNodeFlags_Selected : 0;
+        for (entityx::Entity::Id id : m_ChangedTags)
+        {
+            m_Rows.erase(id.id());
+        }
         
-        bool open = ImGui::TreeNodeEx(tag.c_str() , flags);
+        /* Rows of destroyed entities pile up: drop everything once in a while */
+        if (m_Rows.size() > 2 * m_EntityListPtr->GetLiveCount() + 1024)
+        {
+            m_Rows.clear();
+        }
+    }
+    
+    SceneOverview::Row& SceneOverview::GetRow(const Entity& entity)
+    {
+        uint64_t version = m_GameLayerPtr->GetActiveSceneStructureVersion();
         
-        if (ImGui::IsItemClicked())
+        auto found = m_Rows.find(entity.GetId());
+        if (found != m_Rows.end() && found->second.version == version)
         {
-            context_id = entity.GetId();
+            return found->second;
         }
-                
-        /* Draw simple components */
-        if (open)
+        
+        Row& row = m_Rows[entity.GetId()];
+        if (row.label.empty())
         {
-            ImGui::TextDisabled("ID: %llu", entity.GetId());
-            
-            /* Camera */
-            if (entity.HasComponent<OrthoCameraComponent>())
-            {
-                ImGui::Text("Camera");
-            }
-            
-            /* Transform */
-            if (entity.HasComponent<TransformComponent>())
-            {
-                ImGui::Text("Transform");
-            }
-            
-            /* Sprite */
-            if (entity.HasComponent<SpriteComponent>())
-            {
-                ImGui::Text("Sprite");
-            }
-            
-            /* Behavior */
-            if (entity.HasComponent<BehaviorComponent>())
-            {
-                ImGui::Text("Behavior");
-            }
-            
-            ImGui::TreePop();
+            row.label = entity.ReadComponent<TagComponent>().tag + "##" + std::to_string(entity.GetId());
         }
         
-        /**
-         * This entity is currently selected.
-         */
-        if (flags & ImGuiTreeNodeFlags_Selected)
-        {   
-            return true;
+        /* Components may have been added / removed since last built */
+        row.components.clear();
+        if (entity.HasComponent<OrthoCameraComponent>())    row.components += "Camera ";
+        if (entity.HasComponent<TransformComponent>())      row.components += "Transform ";
+        if (entity.HasComponent<SpriteComponent>())         row.components += "Sprite ";
+        if (entity.HasComponent<BehaviorComponent>())       row.components += "Behavior ";
+        row.version = version;
+        
+        return row;
+    }
+    
+    void SceneOverview::DrawRow(entityx::Entity::Id id)
+    {
+        Entity entity = m_GameLayerPtr->GetActiveSceneEntity(id.id());
+        const Row& row = GetRow(entity);
+        
+        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        flags |= (m_SelectedId == entity.GetId()) ? ImGuiTreeNodeFlags_Selected : 0;
+        
+        ImGui::TreeNodeEx(row.label.c_str(), flags);
+        
+        if (ImGui::IsItemClicked() && m_SelectedId != entity.GetId())
+        {
+            /**
+             * Entity is now selected.
+             * Update Component Inspector panel context to draw its components.
+             */
+            m_SelectedId = entity.GetId();
+            *m_CurrentSelectedEntityPtr = entity;
+            m_ComponentInspectorPtr->ChangeContext(m_CurrentSelectedEntityPtr);
         }
         
-        return false;
+        if (!row.components.empty())
+        {
+            ImGui::SameLine();
+            ImGui::TextDisabled("%s", row.components.c_str());
+        }
     }
     
 }
-}
\ No newline at end of file
+}
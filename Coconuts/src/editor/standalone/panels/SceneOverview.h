@@ -19,6 +19,8 @@
 #include <coconuts/layer_system/GameLayer.h>
 #include "ComponentInspector.h"
 #include <coconuts/ecs/Entity.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Coconuts {
@@ -33,8 +35,18 @@ namespace Panels
         void Draw();
         
     private:
-        void GetLastSceneUpdate();
-        bool DrawNode(Entity& entity);
+        /* Display strings of one row, built when the row is first drawn */
+        struct Row
+        {
+            std::string label;          /* "tag##id" */
+            std::string components;     /* "Camera Transform ..." */
+            uint64_t    version;        /* Structure version components was built at */
+        };
+        
+        void BindActiveScene();
+        void ForgetChangedTags();
+        void DrawRow(entityx::Entity::Id id);
+        Row& GetRow(const Entity& entity);
         
         /* Pointer to the GameLayer */
         GameLayer* m_GameLayerPtr;
@@ -42,7 +54,13 @@ namespace Panels
         /* Pointer to the Component Inspector Panel to change context */
         ComponentInspector* m_ComponentInspectorPtr;
         
-        std::vector<Entity> sceneEntities;
+        /* The Scene's incremental entity list. Only visible rows are drawn */
+        std::weak_ptr<Scene> m_BoundScene;
+        EntityList* m_EntityListPtr = nullptr;
+        uint32_t m_TagConsumer = 0;
+        std::unordered_map<uint64_t, Row> m_Rows;
+        std::vector<entityx::Entity::Id> m_ChangedTags;
+        uint64_t m_SelectedId = 0;
         
         /* To change Component Inspector's context */
         Coconuts::Entity* m_CurrentSelectedEntityPtr;
@@ -16,6 +16,10 @@
 
 #include "Statistics.h"
 #include <coconuts/editor.h>
+#include <coconuts/graphics/MemoryAccountant.h>
+#include <coconuts/time/FramePacer.h>
+#include <coconuts/graphics/RenderThread.h>
+#include <coconuts/Application.h>
 
 namespace Coconuts {
 namespace Panels
@@ -32,6 +36,72 @@ namespace Panels
         ImGui::Text("%d Draw Calls", stats.drawCalls);
         ImGui::Spacing();
         ImGui::Text("%d Quads", stats.quadCount);
+        
+        ImGui::Spacing(); ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Text("Frame Pacing");
+        ImGui::Spacing();
+        
+        float targetFPS = FramePacer::GetTargetFPS();
+        if (ImGui::DragFloat("Target FPS (0 = unlimited)", &targetFPS, 1.0f, 0.0f, 1000.0f, "%.0f"))
+        {
+            FramePacer::SetTargetFPS(targetFPS);
+        }
+        
+        FramePacerStatistics pacing = FramePacer::GetStatistics();
+        ImGui::Text("Frame: %.2f ms (avg %.2f ms, %.0f FPS)", pacing.lastFrameMs, pacing.averageFrameMs,
+                    (pacing.averageFrameMs > 0.0f) ? 1000.0f / pacing.averageFrameMs : 0.0f);
+        ImGui::Text("Min / Max / 99th: %.2f / %.2f / %.2f ms", pacing.minFrameMs, pacing.maxFrameMs, pacing.percentile99Ms);
+        ImGui::Text("Jitter: %.3f ms", pacing.jitterMs);
+        ImGui::Text("Sleep / Spin: %.2f / %.2f ms", pacing.averageSleepMs, pacing.averageSpinMs);
+        ImGui::Text("Missed deadlines: %u", pacing.missedDeadlines);
+        
+        if (RenderThread::IsRunning())
+        {
+            RenderThreadStatistics renderThread = RenderThread::GetStatistics();
+            ImGui::Text("Render thread: %.2f ms (%u commands), game waited %.2f ms",
+                        renderThread.executeMs, renderThread.commandCount, renderThread.gameWaitMs);
+        }
+        
+        ImGui::Spacing(); ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Text("Events");
+        ImGui::Spacing();
+        
+        const EventQueueStatistics& events = Application::GetInstance().GetWindow().GetEventStatistics();
+        ImGui::Text("Last frame: %u queued, %u coalesced, %u dispatched", events.queued, events.coalesced, events.dispatched);
+        ImGui::Text("Total: %llu queued, %llu coalesced, %llu dispatched",
+                    (unsigned long long) events.totalQueued, (unsigned long long) events.totalCoalesced,
+                    (unsigned long long) events.totalDispatched);
+        ImGui::Text("Queue overflows: %u", events.overflows);
+        
+        ImGui::Spacing(); ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Text("Memory");
+        ImGui::Spacing();
+        
+        for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryCategory::Count); i++)
+        {
+            MemoryCategory category = static_cast<MemoryCategory>(i);
+            float kbytes = MemoryAccountant::GetTotalBytes(category) / 1024.0f;
+            
+            if (MemoryAccountant::IsOverBudget(category))
+            {
+                ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s: %.1f KB (%u) over budget!",
+                                   MemoryAccountant::GetCategoryName(category), kbytes,
+                                   MemoryAccountant::GetCount(category));
+            }
+            else
+            {
+                ImGui::Text("%s: %.1f KB (%u)",
+                            MemoryAccountant::GetCategoryName(category), kbytes,
+                            MemoryAccountant::GetCount(category));
+            }
+        }
+        
+        ImGui::Spacing();
+        ImGui::Text("GPU total: %.2f MB", MemoryAccountant::GetTotalGPUBytes() / (1024.0f * 1024.0f));
+        ImGui::Text("CPU total: %.2f MB", MemoryAccountant::GetTotalCPUBytes() / (1024.0f * 1024.0f));
         ImGui::End();
     }
     
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * ccnbench_ecs
+ *
+ * Multi component iteration (Position += Velocity * dt) over half of the
+ * entities, at 10k / 100k / 1M entities:
+ *   - entityx each<>     (what Scene uses: every entity, mask test);
+ *   - sparse set View<>  (walk the smaller array, look the other up);
+ *   - sparse set Group<> (owning group: dense arrays in lockstep).
+ *
+ * Usage: ccnbench_ecs [repeats]
+ */
+
+#include <entityx/entityx.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Logger.h>
+#include "sparse_set/ComponentRegistry.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+
+using namespace Coconuts;
+
+namespace
+{
+    struct Position { float x, y; };
+    struct Velocity { float x, y; };
+    struct Health   { float value; };
+    
+    constexpr float DT = 1.0f / 60.0f;
+    
+    double BestOf(uint32_t repeats, const std::function<void()>& fn)
+    {
+        double best = 1.0e30;
+        for (uint32_t i = 0; i < repeats; i++)
+        {
+            int64_t start = Clock::NowNanoseconds();
+            fn();
+            double ms = (Clock::NowNanoseconds() - start) * 1.0e-6;
+            best = std::min(best, ms);
+        }
+        return best;
+    }
+    
+    /* Same population for both backends: all move-able every other entity, some noise */
+    inline bool HasVelocity(uint32_t i) { return (i % 2) == 0; }
+    inline bool HasHealth(uint32_t i)   { return (i % 3) == 0; }
+    
+    void Run(uint32_t count, uint32_t repeats)
+    {
+        entityx::EntityX ex;
+        ComponentRegistry registry;
+        
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entityx::Entity entity = ex.entities.create();
+            ComponentRegistry::EntityId id = registry.Create();
+            
+            entity.assign<Position>(Position{ (float) i, 0.0f });
+            registry.Assign<Position>(id, Position{ (float) i, 0.0f });
+            
+            if (HasHealth(i))
+            {
+                entity.assign<Health>(Health{ 100.0f });
+                registry.Assign<Health>(id, Health{ 100.0f });
+            }
+            
+            if (HasVelocity(i))
+            {
+                entity.assign<Velocity>(Velocity{ 1.0f, 2.0f });
+                registry.Assign<Velocity>(id, Velocity{ 1.0f, 2.0f });
+            }
+        }
+        
+        double entityxMs = BestOf(repeats, [&]
+        {
+            ex.entities.each<Position, Velocity>([](entityx::Entity entity, Position& p, Velocity& v)
+            {
+                p.x += v.x * DT;
+                p.y += v.y * DT;
+            });
+        });
+        
+        double viewMs = BestOf(repeats, [&]
+        {
+            registry.View<Velocity, Position>([](ComponentRegistry::EntityId entity, Velocity& v, Position& p)
+            {
+                p.x += v.x * DT;
+                p.y += v.y * DT;
+            });
+        });
+        
+        /* First use packs the group (not timed) */
+        uint32_t matching = registry.GetGroupSize<Position, Velocity>();
+        
+        double groupMs = BestOf(repeats, [&]
+        {
+            registry.Group<Position, Velocity>([](ComponentRegistry::EntityId entity, Position& p, Velocity& v)
+            {
+                p.x += v.x * DT;
+                p.y += v.y * DT;
+            });
+        });
+        
+        /* Same number of updates on both sides -> same result */
+        double sumEntityx = 0.0, sumRegistry = 0.0;
+        ex.entities.each<Position>([&](entityx::Entity entity, Position& p) { sumEntityx += p.y; });
+        registry.View<Position>([&](ComponentRegistry::EntityId entity, Position& p) { sumRegistry += p.y; });
+        
+        if (std::abs(sumEntityx * 2.0 - sumRegistry) > 1.0e-3 * std::abs(sumRegistry))
+        {
+            std::printf("mismatch: entityx %f, registry %f\n", sumEntityx, sumRegistry);
+        }
+        
+        std::printf("%9u %9u | %9.3f ms %6.2f | %9.3f ms %6.2f %6.1fx | %9.3f ms %6.2f %6.1fx\n",
+                    count, matching,
+                    entityxMs, entityxMs * 1.0e6 / matching,
+                    viewMs, viewMs * 1.0e6 / matching, entityxMs / viewMs,
+                    groupMs, groupMs * 1.0e6 / matching, entityxMs / groupMs);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Logger::Init();
+    
+    uint32_t repeats = (argc > 1) ? (uint32_t) std::strtoul(argv[1], nullptr, 10) : 10;
+    
+    std::printf("Position += Velocity * dt, best of %u (ns / matching entity)\n\n", repeats);
+    std::printf("%9s %9s | %12s %6s | %12s %6s %7s | %12s %6s %7s\n",
+                "entities", "matching", "entityx", "ns", "view", "ns", "gain", "group", "ns", "gain");
+    
+    const uint32_t counts[] = { 10000, 100000, 1000000 };
+    for (uint32_t count : counts)
+    {
+        Run(count, repeats);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * ccnbench_events
+ *
+ * Cost of dispatching one MouseCursorMove to a Scene with N Event Handlers
+ * (10 .. 10k), 1 in 100 of them listening to the mouse, the rest to keys:
+ *   - filtering:   every handler subscribes to all events and filters in
+ *                  OnEvent (EventDispatcher), as before subscription masks;
+ *   - subscribed:  handlers declare their EventTypes, the Scene's index
+ *                  only calls the interested ones.
+ * Reported in nanoseconds per event (lower is better).
+ *
+ * Usage: ccnbench_events [events] [repeats]
+ */
+
+#include <coconuts/ECS.h>
+#include <coconuts/EventSystem.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace Coconuts;
+
+namespace
+{
+    uint64_t s_Handled = 0;
+    
+    /* Subscribed to everything: filters itself */
+    class FilteringHandler : public EventHandler
+    {
+    public:
+        void OnEvent(Event& e)
+        {
+            EventDispatcher dispatcher(e);
+            dispatcher.Dispatch<InputKeyEvent::KeyPress>(BIND_EVENT_FUNCTION(FilteringHandler::OnKeyPress));
+        }
+        
+    private:
+        bool OnKeyPress(InputKeyEvent::KeyPress& e) { s_Handled++; return false; }
+    };
+    
+    class FilteringMouseHandler : public EventHandler
+    {
+    public:
+        void OnEvent(Event& e)
+        {
+            EventDispatcher dispatcher(e);
+            dispatcher.Dispatch<InputMouseEvent::MouseCursorMove>(BIND_EVENT_FUNCTION(FilteringMouseHandler::OnMove));
+        }
+        
+    private:
+        bool OnMove(InputMouseEvent::MouseCursorMove& e) { s_Handled++; return false; }
+    };
+    
+    /* Same work, declared subscriptions */
+    class KeyHandler : public FilteringHandler
+    {
+    public:
+        static EventMask GetEventSubscriptions() { return EventMaskOf(Category_InputKeyEvent); }
+    };
+    
+    class MouseHandler : public FilteringMouseHandler
+    {
+    public:
+        static EventMask GetEventSubscriptions() { return EventMaskOf(EventType::MouseCursorMove); }
+    };
+    
+    inline double ElapsedNs(int64_t start)
+    {
+        return (double) (Clock::NowNanoseconds() - start);
+    }
+    
+    template <typename KeyC, typename MouseC>
+    double Dispatch(uint32_t handlers, uint32_t events, uint32_t repeats)
+    {
+        std::unique_ptr<Scene> scene(new Scene(0, "ccnbench_events"));
+        
+        for (uint32_t i = 0; i < handlers; i++)
+        {
+            Entity entity(scene.get(), "Handler");
+            if (i % 100 == 0)
+            {
+                entity.AddComponent<EventHandlerComponent>().AddHandler<MouseC>(entity);
+            }
+            else
+            {
+                entity.AddComponent<EventHandlerComponent>().AddHandler<KeyC>(entity);
+            }
+        }
+        
+        InputMouseEvent::MouseCursorMove move(1.0, 2.0);
+        
+        /* Builds the subscription index outside of the timed loop */
+        scene->OnEvent(move);
+        
+        double best = 1.0e30;
+        for (uint32_t r = 0; r < repeats; r++)
+        {
+            int64_t start = Clock::NowNanoseconds();
+            for (uint32_t i = 0; i < events; i++)
+            {
+                scene->OnEvent(move);
+            }
+            best = std::min(best, ElapsedNs(start) / events);
+        }
+        
+        return best;
+    }
+    
+    void Run(uint32_t handlers, uint32_t events, uint32_t repeats)
+    {
+        double filtering = Dispatch<FilteringHandler, FilteringMouseHandler>(handlers, events, repeats);
+        double subscribed = Dispatch<KeyHandler, MouseHandler>(handlers, events, repeats);
+        
+        std::printf("%9u | %12.1f %12.1f %7.2fx\n", handlers, filtering, subscribed, filtering / subscribed);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Logger::Init();
+    
+    uint32_t events = (argc > 1) ? (uint32_t) std::strtoul(argv[1], nullptr, 10) : 10000;
+    uint32_t repeats = (argc > 2) ? (uint32_t) std::strtoul(argv[2], nullptr, 10) : 5;
+    
+    std::printf("MouseCursorMove dispatch, 1%% mouse handlers, %u events, best of %u (ns / event)\n\n", events, repeats);
+    std::printf("%9s | %12s %12s %8s\n", "handlers", "filtering", "subscribed", "gain");
+    
+    const uint32_t counts[] = { 10, 100, 1000, 10000 };
+    for (uint32_t count : counts)
+    {
+        Run(count, std::max<uint32_t>(1, events / std::max<uint32_t>(1, count / 100)), repeats);
+    }
+    
+    std::printf("\n(%llu events handled)\n", (unsigned long long) s_Handled);
+    
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * ccnbench_jobs
+ *
+ * JobSystem scaling from 1 thread (main only) to every hardware thread:
+ *   - ParallelFor over a compute bound array transform;
+ *   - many tiny jobs on one counter (scheduling / stealing overhead).
+ *
+ * Usage: ccnbench_jobs [elements] [repeats]
+ */
+
+#include <coconuts/jobs/JobSystem.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace Coconuts;
+
+namespace
+{
+    constexpr uint32_t TINY_JOBS = 100000;
+    
+    double BestOf(uint32_t repeats, const std::function<void()>& fn)
+    {
+        double best = 1.0e30;
+        for (uint32_t i = 0; i < repeats; i++)
+        {
+            int64_t start = Clock::NowNanoseconds();
+            fn();
+            double ms = (Clock::NowNanoseconds() - start) * 1.0e-6;
+            best = std::min(best, ms);
+        }
+        return best;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Logger::Init();
+    
+    uint32_t elements = (argc > 1) ? (uint32_t) std::strtoul(argv[1], nullptr, 10) : 1u << 22;
+    uint32_t repeats  = (argc > 2) ? (uint32_t) std::strtoul(argv[2], nullptr, 10) : 5;
+    uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    
+    std::vector<float> input(elements), output(elements);
+    for (uint32_t i = 0; i < elements; i++)
+    {
+        input[i] = (float) i * 0.001f;
+    }
+    
+    std::printf("%u elements, best of %u, %u hardware threads\n\n", elements, repeats, hardware);
+    std::printf("%8s | %14s %8s %7s | %14s %10s\n", "threads", "parallel_for", "speedup", "eff.", "tiny jobs", "ns / job");
+    
+    double baseline = 0.0;
+    for (uint32_t threads = 1; threads <= hardware; threads++)
+    {
+        /* threads - 1 workers + main thread (1 thread: inline) */
+        if (threads > 1)
+        {
+            JobSystem::Init(threads - 1);
+        }
+        
+        double parallelMs = BestOf(repeats, [&]
+        {
+            JobSystem::ParallelFor(elements, 0, [&](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; i++)
+                {
+                    float x = input[i];
+                    output[i] = std::sqrt(x) * std::sin(x) + std::cos(x * 0.5f);
+                }
+            });
+        });
+        
+        double tinyMs = BestOf(repeats, [&]
+        {
+            std::atomic<uint32_t> sum {0};
+            JobCounter counter;
+            for (uint32_t i = 0; i < TINY_JOBS; i++)
+            {
+                JobSystem::Schedule([&sum] { sum.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+            JobSystem::Wait(counter);
+            
+            if (sum != TINY_JOBS)
+            {
+                std::printf("tiny jobs: lost jobs (%u)\n", sum.load());
+                std::exit(1);
+            }
+        });
+        
+        if (threads == 1)
+        {
+            baseline = parallelMs;
+        }
+        
+        double speedup = baseline / parallelMs;
+        std::printf("%8u | %11.2f ms %7.2fx %6.0f%% | %11.2f ms %10.1f\n",
+                    threads, parallelMs, speedup, 100.0 * speedup / threads,
+                    tinyMs, tinyMs * 1.0e6 / TINY_JOBS);
+        
+        JobSystem::Shutdown();
+    }
+    
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * ccnbench_spawn
+ *
+ * Spawning and destroying N sprite entities (Tag + Transform + Sprite)
+ * in a Scene, at 1k / 10k / 100k entities:
+ *   - one by one:  Entity + AddComponent<>, DestroyEntity() per id;
+ *   - bulk:        Scene::Instantiate(prefab, N), Scene::DestroyEntities().
+ * Reported in entities per second (higher is better).
+ *
+ * Usage: ccnbench_spawn [repeats]
+ */
+
+#include <coconuts/ECS.h>
+#include <coconuts/ecs/Prefab.h>
+#include <coconuts/time/Clock.h>
+#include <coconuts/Logger.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace Coconuts;
+
+namespace
+{
+    struct Timings
+    {
+        double spawnMs;
+        double destroyMs;
+        
+        Timings() : spawnMs(1.0e30), destroyMs(1.0e30) {}
+    };
+    
+    inline double ElapsedMs(int64_t start)
+    {
+        return (Clock::NowNanoseconds() - start) * 1.0e-6;
+    }
+    
+    inline double PerSecond(uint32_t count, double ms)
+    {
+        return count / (ms * 1.0e-3);
+    }
+    
+    /* Every run gets a fresh Scene: no recycled indices, no reserved tables */
+    Timings OneByOne(uint32_t count, uint32_t repeats)
+    {
+        Timings best;
+        
+        for (uint32_t r = 0; r < repeats; r++)
+        {
+            std::unique_ptr<Scene> scene(new Scene(0, "ccnbench_spawn"));
+            std::vector<uint64_t> ids; ids.reserve(count);
+            
+            int64_t start = Clock::NowNanoseconds();
+            for (uint32_t i = 0; i < count; i++)
+            {
+                Entity entity(scene.get(), "Bullet");
+                entity.AddComponent<TransformComponent>(glm::vec2(0.0f, 1.0f), glm::vec2(0.25f));
+                entity.AddComponent<SpriteComponent>();
+                ids.push_back(entity.GetId());
+            }
+            best.spawnMs = std::min(best.spawnMs, ElapsedMs(start));
+            
+            start = Clock::NowNanoseconds();
+            for (uint64_t id : ids)
+            {
+                scene->DestroyEntity(id);
+            }
+            best.destroyMs = std::min(best.destroyMs, ElapsedMs(start));
+        }
+        
+        return best;
+    }
+    
+    Timings Bulk(uint32_t count, uint32_t repeats)
+    {
+        Timings best;
+        
+        Prefab bullet("Bullet", "Bullet");
+        bullet.hasTransform = true;
+        bullet.transform = TransformComponent(glm::vec2(0.0f, 1.0f), glm::vec2(0.25f));
+        bullet.hasSprite = true;
+        
+        for (uint32_t r = 0; r < repeats; r++)
+        {
+            std::unique_ptr<Scene> scene(new Scene(0, "ccnbench_spawn"));
+            std::vector<Entity> created;
+            
+            int64_t start = Clock::NowNanoseconds();
+            uint32_t spawned = scene->Instantiate(bullet, count, &created);
+            best.spawnMs = std::min(best.spawnMs, ElapsedMs(start));
+            
+            if (spawned != count)
+            {
+                std::printf("Instantiate: %u of %u spawned\n", spawned, count);
+            }
+            
+            /* Collecting ids is part of the caller's work, not timed */
+            std::vector<uint64_t> ids; ids.reserve(count);
+            for (const Entity& entity : created)
+            {
+                ids.push_back(entity.GetId());
+            }
+            
+            start = Clock::NowNanoseconds();
+            uint32_t destroyed = scene->DestroyEntities(ids);
+            best.destroyMs = std::min(best.destroyMs, ElapsedMs(start));
+            
+            if (destroyed != count)
+            {
+                std::printf("DestroyEntities: %u of %u destroyed\n", destroyed, count);
+            }
+        }
+        
+        return best;
+    }
+    
+    void Run(uint32_t count, uint32_t repeats)
+    {
+        Timings single = OneByOne(count, repeats);
+        Timings bulk = Bulk(count, repeats);
+        
+        std::printf("%9u | %12.0f %12.0f %6.2fx | %12.0f %12.0f %6.2fx\n",
+                    count,
+                    PerSecond(count, single.spawnMs), PerSecond(count, bulk.spawnMs), single.spawnMs / bulk.spawnMs,
+                    PerSecond(count, single.destroyMs), PerSecond(count, bulk.destroyMs), single.destroyMs / bulk.destroyMs);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Logger::Init();
+    
+    uint32_t repeats = (argc > 1) ? (uint32_t) std::strtoul(argv[1], nullptr, 10) : 5;
+    
+    std::printf("Tag + Transform + Sprite entities, best of %u (entities / second)\n\n", repeats);
+    std::printf("%9s | %12s %12s %7s | %12s %12s %7s\n",
+                "entities", "spawn 1by1", "instantiate", "gain", "destroy 1by1", "bulk", "gain");
+    
+    const uint32_t counts[] = { 1000, 10000, 100000 };
+    for (uint32_t count : counts)
+    {
+        Run(count, repeats);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ComponentRegistry.h"
+#include <coconuts/Logger.h>
+#include <algorithm>
+
+namespace Coconuts
+{
+    
+    std::atomic<uint32_t> ComponentRegistry::s_NextTypeId {0};
+    
+    ComponentRegistry::EntityId ComponentRegistry::Create()
+    {
+        uint32_t index;
+        if (!m_FreeList.empty())
+        {
+            index = m_FreeList.back();
+            m_FreeList.pop_back();
+        }
+        else
+        {
+            index = (uint32_t) m_Versions.size();
+            m_Versions.push_back(0);
+        }
+        
+        return MakeId(index);
+    }
+    
+    void ComponentRegistry::Destroy(EntityId entity)
+    {
+        if (!IsValid(entity))
+        {
+            return;
+        }
+        
+        uint32_t index = Index(entity);
+        for (uint32_t type = 0; type < m_Pools.size(); type++)
+        {
+            if (m_Pools[type] != nullptr && m_Pools[type]->Contains(index))
+            {
+                RemoveComponent(type, index);
+            }
+        }
+        
+        m_Versions[index]++;
+        m_FreeList.push_back(index);
+    }
+    
+    bool ComponentRegistry::IsValid(EntityId entity) const
+    {
+        uint32_t index = Index(entity);
+        return index < m_Versions.size() && m_Versions[index] == (uint32_t) (entity >> 32);
+    }
+    
+    bool ComponentRegistry::OwnsAll(const GroupData& group, uint32_t index) const
+    {
+        for (uint32_t type : group.owned)
+        {
+            if (!m_Pools[type]->Contains(index))
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    void ComponentRegistry::OnAssigned(uint32_t type, uint32_t index)
+    {
+        int32_t owner = m_OwnerGroup[type];
+        if (owner < 0)
+        {
+            return;
+        }
+        
+        GroupData& group = m_Groups[owner];
+        if (!OwnsAll(group, index))
+        {
+            return;
+        }
+        
+        /* Completes the group: move it to the end of the packed range in every owned array */
+        for (uint32_t owned : group.owned)
+        {
+            SparseSetBase& pool = *m_Pools[owned];
+            pool.Swap(pool.GetPosition(index), group.size);
+        }
+        group.size++;
+    }
+    
+    void ComponentRegistry::RemoveComponent(uint32_t type, uint32_t index)
+    {
+        int32_t owner = m_OwnerGroup[type];
+        if (owner >= 0)
+        {
+            GroupData& group = m_Groups[owner];
+            
+            /* Leaves the group: swap with the last packed entity everywhere */
+            if (m_Pools[type]->GetPosition(index) < group.size)
+            {
+                group.size--;
+                for (uint32_t owned : group.owned)
+                {
+                    SparseSetBase& pool = *m_Pools[owned];
+                    pool.Swap(pool.GetPosition(index), group.size);
+                }
+            }
+        }
+        
+        m_Pools[type]->Remove(index);
+    }
+    
+    int32_t ComponentRegistry::FindOrCreateGroup(const uint32_t* types, uint32_t count)
+    {
+        /* Already owned: must be the very same group */
+        int32_t owner = m_OwnerGroup[types[0]];
+        if (owner >= 0)
+        {
+            const GroupData& group = m_Groups[owner];
+            bool same = (group.owned.size() == count);
+            for (uint32_t i = 0; same && i < count; i++)
+            {
+                same = (m_OwnerGroup[types[i]] == owner);
+            }
+            
+            if (!same)
+            {
+                LOG_ERROR("ComponentRegistry - Group conflicts with an existing one (a type has one owner only)");
+                return INVALID_GROUP;
+            }
+            
+            return owner;
+        }
+        
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (m_OwnerGroup[types[i]] >= 0)
+            {
+                LOG_ERROR("ComponentRegistry - Group conflicts with an existing one (a type has one owner only)");
+                return INVALID_GROUP;
+            }
+        }
+        
+        int32_t id = (int32_t) m_Groups.size();
+        m_Groups.push_back({ std::vector<uint32_t>(types, types + count), 0 });
+        GroupData& group = m_Groups.back();
+        
+        for (uint32_t type : group.owned)
+        {
+            m_OwnerGroup[type] = id;
+        }
+        
+        /* Pack the entities that already have everything */
+        uint32_t smallest = *std::min_element(group.owned.begin(), group.owned.end(), [this](uint32_t a, uint32_t b)
+        {
+            return m_Pools[a]->GetSize() < m_Pools[b]->GetSize();
+        });
+        
+        SparseSetBase& lead = *m_Pools[smallest];
+        for (uint32_t position = 0; position < lead.GetSize(); position++)
+        {
+            uint32_t index = lead.GetEntity(position);
+            if (!OwnsAll(group, index))
+            {
+                continue;
+            }
+            
+            for (uint32_t owned : group.owned)
+            {
+                SparseSetBase& pool = *m_Pools[owned];
+                pool.Swap(pool.GetPosition(index), group.size);
+            }
+            group.size++;
+        }
+        
+        return id;
+    }
+    
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef COMPONENTREGISTRY_H
+#define COMPONENTREGISTRY_H
+
+#include "SparseSet.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Sparse set component storage.
+     * Every component type lives in its own dense array. Multi component
+     * queries either walk the smallest array and look the others up
+     * (View), or, for hot combinations, use an owning Group: the arrays it
+     * owns keep the entities having all of its components at the front, in
+     * the same order, so iteration is a plain loop over dense arrays.
+     *
+     * A component type can be owned by one Group only: a conflicting
+     * Group is refused (logged) and iterates nothing.
+     *
+     * Not part of ccncore: Scene and Entity store Components in entityx.
+     * This is the sparse set layout ccnbench_ecs measures against it.
+     */
+    class ComponentRegistry
+    {
+    public:
+        /* Index in the low 32 bits, version (reuse count) in the high ones */
+        using EntityId = uint64_t;
+        static constexpr EntityId NULL_ENTITY = UINT64_MAX;
+        
+        ComponentRegistry() = default;
+        ComponentRegistry(const ComponentRegistry&) = delete;
+        ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+        
+        EntityId Create();
+        void Destroy(EntityId entity);
+        bool IsValid(EntityId entity) const;
+        size_t GetEntityCount() const { return m_Versions.size() - m_FreeList.size(); }
+        
+        template <typename T, typename... Args>
+        T& Assign(EntityId entity, Args&&... args)
+        {
+            uint32_t index = Index(entity);
+            
+            /* Already has one: replaced in place (group membership unchanged) */
+            if (Has<T>(entity))
+            {
+                return GetPool<T>().Get(index) = T(std::forward<Args>(args)...);
+            }
+            
+            GetPool<T>().Emplace(index, std::forward<Args>(args)...);
+            OnAssigned(TypeId<T>(), index);
+            
+            /* Group may have moved it */
+            return GetPool<T>().Get(index);
+        }
+        
+        template <typename T>
+        void Remove(EntityId entity)
+        {
+            RemoveComponent(TypeId<T>(), Index(entity));
+        }
+        
+        template <typename T>
+        bool Has(EntityId entity) const
+        {
+            uint32_t type = TypeId<T>();
+            return type < m_Pools.size() && m_Pools[type] != nullptr && m_Pools[type]->Contains(Index(entity));
+        }
+        
+        template <typename T>
+        T& Get(EntityId entity)
+        {
+            return GetPool<T>().Get(Index(entity));
+        }
+        
+        /* Entities with all Components: walks the first type, looks the rest up */
+        template <typename T, typename... Others, typename Function>
+        void View(Function fn)
+        {
+            SparseSet<T>& lead = GetPool<T>();
+            
+            for (uint32_t position = 0; position < lead.GetSize(); position++)
+            {
+                uint32_t index = lead.GetEntity(position);
+                if (HasAll<Others...>(index))
+                {
+                    fn(MakeId(index), lead.At(position), GetPool<Others>().Get(index)...);
+                }
+            }
+        }
+        
+        /**
+         * Owning Group of Components (created on first use).
+         * Iterates [0, size) of every owned array in lockstep.
+         */
+        template <typename... Owned, typename Function>
+        void Group(Function fn)
+        {
+            uint32_t size = GetGroupSize<Owned...>();
+            
+            /* One base pointer per type: positions line up across arrays */
+            const uint32_t* entities = GetPool<typename First<Owned...>::Type>().GetEntities();
+            EachInGroup(size, entities, fn, GetPool<Owned>().GetComponents()...);
+        }
+        
+        template <typename... Owned>
+        uint32_t GetGroupSize()
+        {
+            uint32_t types[] = { TypeId<Owned>()... };
+            
+            /* Make sure every pool exists */
+            int expand[] = { 0, ((void) GetPool<Owned>(), 0)... };
+            (void) expand;
+            
+            int32_t group = FindOrCreateGroup(types, sizeof...(Owned));
+            return (group != INVALID_GROUP) ? m_Groups[group].size : 0;
+        }
+        
+        template <typename T>
+        static uint32_t TypeId()
+        {
+            static const uint32_t id = s_NextTypeId++;
+            return id;
+        }
+        
+    private:
+        struct GroupData
+        {
+            std::vector<uint32_t>   owned;  /* type ids */
+            uint32_t                size;   /* entities having all of them */
+        };
+        
+        std::vector<uint32_t>                       m_Versions;
+        std::vector<uint32_t>                       m_FreeList;
+        std::vector<std::unique_ptr<SparseSetBase>> m_Pools;        /* by TypeId */
+        std::vector<int32_t>                        m_OwnerGroup;   /* by TypeId, -1 -> none */
+        std::vector<GroupData>                      m_Groups;
+        
+        static std::atomic<uint32_t> s_NextTypeId;
+        static constexpr int32_t INVALID_GROUP = -1;
+        
+    private:
+        template <typename T, typename...>
+        struct First { using Type = T; };
+        
+        static uint32_t Index(EntityId entity) { return (uint32_t) (entity & 0xFFFFFFFFu); }
+        EntityId MakeId(uint32_t index) const { return ((EntityId) m_Versions[index] << 32) | index; }
+        
+        template <typename T>
+        SparseSet<T>& GetPool()
+        {
+            uint32_t type = TypeId<T>();
+            if (type >= m_Pools.size())
+            {
+                m_Pools.resize(type + 1);
+                m_OwnerGroup.resize(type + 1, -1);
+            }
+            
+            if (m_Pools[type] == nullptr)
+            {
+                m_Pools[type].reset(new SparseSet<T>());
+            }
+            
+            return *static_cast<SparseSet<T>*>(m_Pools[type].get());
+        }
+        
+        template <typename... Others>
+        bool HasAll(uint32_t index)
+        {
+            bool has[] = { true, GetPool<Others>().Contains(index)... };
+            for (bool h : has)
+            {
+                if (!h) return false;
+            }
+            return true;
+        }
+        
+        template <typename Function, typename... Components>
+        void EachInGroup(uint32_t size, const uint32_t* entities, Function& fn, Components*... components)
+        {
+            for (uint32_t i = 0; i < size; i++)
+            {
+                fn(MakeId(entities[i]), components[i]...);
+            }
+        }
+        
+        int32_t FindOrCreateGroup(const uint32_t* types, uint32_t count);
+        bool OwnsAll(const GroupData& group, uint32_t index) const;
+        void OnAssigned(uint32_t type, uint32_t index);
+        void RemoveComponent(uint32_t type, uint32_t index);
+    };
+    
+}
+
+#endif /* COMPONENTREGISTRY_H */
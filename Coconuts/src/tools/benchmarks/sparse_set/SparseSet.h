@@ -0,0 +1,144 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SPARSESET_H
+#define SPARSESET_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Coconuts
+{
+    
+    /**
+     * Entity indices with O(1) insert / remove / lookup.
+     * sparse[entity] -> position in dense, dense[position] -> entity.
+     * Positions are what component arrays are indexed with.
+     */
+    class SparseSetBase
+    {
+    public:
+        static constexpr uint32_t NONE = UINT32_MAX;
+        
+        virtual ~SparseSetBase() = default;
+        
+        bool Contains(uint32_t entity) const
+        {
+            return entity < m_Sparse.size() && m_Sparse[entity] != NONE;
+        }
+        
+        uint32_t GetPosition(uint32_t entity) const { return m_Sparse[entity]; }
+        uint32_t GetEntity(uint32_t position) const { return m_Dense[position]; }
+        uint32_t GetSize() const { return (uint32_t) m_Dense.size(); }
+        const uint32_t* GetEntities() const { return m_Dense.data(); }
+        
+        /* Exchanges two positions (and their components) */
+        void Swap(uint32_t a, uint32_t b)
+        {
+            if (a == b)
+            {
+                return;
+            }
+            
+            std::swap(m_Dense[a], m_Dense[b]);
+            m_Sparse[m_Dense[a]] = a;
+            m_Sparse[m_Dense[b]] = b;
+            SwapComponents(a, b);
+        }
+        
+        /* Last position fills the hole */
+        virtual void Remove(uint32_t entity) = 0;
+        
+    protected:
+        std::vector<uint32_t> m_Sparse;
+        std::vector<uint32_t> m_Dense;
+        
+    protected:
+        uint32_t Insert(uint32_t entity)
+        {
+            if (entity >= m_Sparse.size())
+            {
+                m_Sparse.resize(entity + 1, (uint32_t) NONE);   /* copy: NONE has no out of line definition */
+            }
+            
+            m_Sparse[entity] = (uint32_t) m_Dense.size();
+            m_Dense.push_back(entity);
+            return m_Sparse[entity];
+        }
+        
+        uint32_t Erase(uint32_t entity)
+        {
+            uint32_t position = m_Sparse[entity];
+            uint32_t last = (uint32_t) m_Dense.size() - 1;
+            
+            m_Dense[position] = m_Dense[last];
+            m_Sparse[m_Dense[position]] = position;
+            m_Dense.pop_back();
+            m_Sparse[entity] = NONE;
+            
+            return position;
+        }
+        
+        virtual void SwapComponents(uint32_t a, uint32_t b) = 0;
+    };
+    
+    /* Components of type T, packed in the same order as the entities */
+    template <typename T>
+    class SparseSet : public SparseSetBase
+    {
+    public:
+        template <typename... Args>
+        T& Emplace(uint32_t entity, Args&&... args)
+        {
+            /* One component per entity: replace */
+            if (Contains(entity))
+            {
+                return Get(entity) = T(std::forward<Args>(args)...);
+            }
+            
+            Insert(entity);
+            m_Components.emplace_back(std::forward<Args>(args)...);
+            return m_Components.back();
+        }
+        
+        void Remove(uint32_t entity) override
+        {
+            uint32_t position = Erase(entity);
+            
+            if (position != m_Components.size() - 1)
+            {
+                m_Components[position] = std::move(m_Components.back());
+            }
+            m_Components.pop_back();
+        }
+        
+        T& Get(uint32_t entity) { return m_Components[m_Sparse[entity]]; }
+        T& At(uint32_t position) { return m_Components[position]; }
+        T* GetComponents() { return m_Components.data(); }
+        
+    protected:
+        void SwapComponents(uint32_t a, uint32_t b) override
+        {
+            std::swap(m_Components[a], m_Components[b]);
+        }
+        
+    private:
+        std::vector<T> m_Components;
+    };
+    
+}
+
+#endif /* SPARSESET_H */
@@ -0,0 +1,252 @@
+/*
+ * Copyright 2021 Andre Temprilho
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * ccnpacker
+ *
+ * Builds a .ccnpak archive from a .ccnproj project file:
+ *   - the project file itself (verbatim YAML text);
+ *   - every <Texture2D> it references, cooked (decoded and flipped) so
+ *     the runtime can upload it straight from the memory mapped archive.
+ *
+ * Relative texture paths are resolved against the .ccnproj directory, which
+ * matches the runtime when the project lives next to the application binary.
+ *
+ * Usage: ccnpacker <project.ccnproj> [output.ccnpak]
+ */
+
+#include <AssetPackFormat.h>
+#include <stb/stb_image.h>
+#include <yaml-cpp/yaml.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+using namespace Coconuts;
+
+namespace {
+namespace Parser
+{
+    /* Must match AssetSerializer */
+    constexpr auto ROOT_NODE_ASSETMANAGER = "<AssetManager>";
+    constexpr auto KEY_SEQ_NODE_TEXTURES2DLIST = "Textures2D List";
+    constexpr auto CLASS_NODE_TEXTURE2D = "<Texture2D>";
+    constexpr auto KEY_STR_PATH = "path";
+}
+} //namespace
+
+struct PendingEntry
+{
+    PackFormat::PackEntry   entry;
+    std::string             name;
+};
+
+static std::string DirName(const std::string& path)
+{
+    size_t pos = path.find_last_of('/');
+    return (pos == std::string::npos) ? std::string("./") : path.substr(0, pos + 1);
+}
+
+static void WritePadding(std::ofstream& out, uint64_t& cursor)
+{
+    static const char zeros[PackFormat::BLOB_ALIGNMENT] = {0};
+    uint64_t aligned = PackFormat::AlignUp(cursor);
+
+    out.write(zeros, aligned - cursor);
+    cursor = aligned;
+}
+
+static void WriteBlob(std::ofstream& out, uint64_t& cursor, PendingEntry& pending, const void* data, uint64_t size)
+{
+    WritePadding(out, cursor);
+
+    pending.entry.offset = cursor;
+    pending.entry.size = size;
+
+    out.write(static_cast<const char*>(data), size);
+    cursor += size;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s <project.ccnproj> [output.ccnpak]\n", argv[0]);
+        return 1;
+    }
+
+    std::string projectPath = argv[1];
+    std::string outputPath;
+
+    if (argc > 2)
+    {
+        outputPath = argv[2];
+    }
+    else
+    {
+        outputPath = projectPath.substr(0, projectPath.find_last_of('.')) + ".ccnpak";
+    }
+
+    /* Read project */
+    std::ifstream projectFile(projectPath);
+    if (!projectFile.is_open())
+    {
+        fprintf(stderr, "Failed to open %s\n", projectPath.c_str());
+        return 1;
+    }
+
+    std::stringstream stream;
+    stream << projectFile.rdbuf();
+    std::string project = stream.str();
+    projectFile.close();
+
+    /* Collect referenced textures (unique paths, as written in the project) */
+    std::vector<std::string> texturePaths;
+    std::unordered_set<std::string> seen;
+
+    YAML::Node root = YAML::Load(project);
+    auto textures2d_list = root[Parser::ROOT_NODE_ASSETMANAGER][Parser::KEY_SEQ_NODE_TEXTURES2DLIST];
+    if (textures2d_list)
+    {
+        for (auto texture2d : textures2d_list)
+        {
+            auto texture2d_node = texture2d[Parser::CLASS_NODE_TEXTURE2D];
+            if (texture2d_node && texture2d_node[Parser::KEY_STR_PATH])
+            {
+                std::string path = texture2d_node[Parser::KEY_STR_PATH].as<std::string>();
+                if (seen.insert(path).second)
+                {
+                    texturePaths.emplace_back(path);
+                }
+            }
+        }
+    }
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        fprintf(stderr, "Failed to create %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    /* Header is patched at the end */
+    PackFormat::PackHeader header;
+    memset(&header, 0x00, sizeof(header));
+    memcpy(header.magic, PackFormat::MAGIC, sizeof(PackFormat::MAGIC));
+    header.version = PackFormat::VERSION;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t cursor = sizeof(header);
+
+    std::vector<PendingEntry> entries;
+    entries.reserve(texturePaths.size() + 1);
+
+    /* (1) Serialized project */
+    {
+        PendingEntry pending;
+        memset(&pending.entry, 0x00, sizeof(pending.entry));
+        pending.entry.type = PackFormat::EntryType::Project;
+        pending.name = PackFormat::PROJECT_ENTRY_NAME;
+
+        WriteBlob(out, cursor, pending, project.data(), project.size());
+        entries.emplace_back(pending);
+    }
+
+    /* (2) Cooked textures (same decoding as OpenGLTexture2D) */
+    std::string projectDir = DirName(projectPath);
+    stbi_set_flip_vertically_on_load(1);
+
+    for (auto& path : texturePaths)
+    {
+        std::string srcPath = (path.at(0) == '/') ? path : projectDir + path;
+
+        int width, height, channels;
+        stbi_uc* data = stbi_load(srcPath.c_str(), &width, &height, &channels, 0);
+
+        /* Runtime only uploads RGB8 or RGBA8 */
+        if (data != nullptr && channels != 3 && channels != 4)
+        {
+            stbi_image_free(data);
+            data = stbi_load(srcPath.c_str(), &width, &height, &channels, 4);
+            channels = 4;
+        }
+
+        if (data == nullptr)
+        {
+            fprintf(stderr, "Failed to load image %s (%s)\n", srcPath.c_str(), stbi_failure_reason());
+            out.close();
+            remove(outputPath.c_str());
+            return 1;
+        }
+
+        PendingEntry pending;
+        memset(&pending.entry, 0x00, sizeof(pending.entry));
+        pending.entry.type = PackFormat::EntryType::Texture2D;
+        pending.entry.width = width;
+        pending.entry.height = height;
+        pending.entry.channels = channels;
+        pending.name = path;
+
+        WriteBlob(out, cursor, pending, data, (uint64_t) width * height * channels);
+        entries.emplace_back(pending);
+        stbi_image_free(data);
+
+        printf("  + %s (%dx%d, %d channels)\n", path.c_str(), width, height, channels);
+    }
+
+    /* (3) Table of contents */
+    WritePadding(out, cursor);
+    header.tocOffset = cursor;
+    header.entryCount = entries.size();
+
+    uint32_t nameOffset = 0;
+    for (auto& pending : entries)
+    {
+        pending.entry.nameOffset = nameOffset;
+        pending.entry.nameSize = pending.name.size();
+        nameOffset += pending.entry.nameSize;
+
+        out.write(reinterpret_cast<const char*>(&pending.entry), sizeof(pending.entry));
+        cursor += sizeof(pending.entry);
+    }
+
+    /* (4) Names string table */
+    header.namesOffset = cursor;
+    for (auto& pending : entries)
+    {
+        out.write(pending.name.data(), pending.name.size());
+        cursor += pending.name.size();
+    }
+
+    /* Patch header */
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+
+    if (out.fail())
+    {
+        fprintf(stderr, "Failed to write %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    printf("Packed %u entries into %s (%llu bytes)\n",
+           header.entryCount, outputPath.c_str(), (unsigned long long) cursor);
+    return 0;
+}